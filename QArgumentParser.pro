@@ -54,20 +54,57 @@ INCLUDEPATH += include
 #
 ###########################################################
 HEADERS += include/QArgumentParser/Config.hpp \
+           include/QArgumentParser/QArgumentArena.hpp \
+           include/QArgumentParser/QArgumentBinding.hpp \
+           include/QArgumentParser/QArgumentConfigFile.hpp \
+           include/QArgumentParser/QArgumentError.hpp \
+           include/QArgumentParser/QArgumentFileCache.hpp \
+           include/QArgumentParser/QArgumentList.hpp \
+           include/QArgumentParser/QArgumentMappedFile.hpp \
            include/QArgumentParser/QArgumentOption.hpp \
+           include/QArgumentParser/QArgumentOptionView.hpp \
            include/QArgumentParser/QArgumentValidator.hpp \
            include/QArgumentParser/QArgumentValidatorOption.hpp \
            include/QArgumentParser/QArgumentParser.hpp \
-           include/QArgumentParser/QArgumentOption.inl
+           include/QArgumentParser/QArgumentSchema.hpp \
+           include/QArgumentParser/QArgumentSnapshot.hpp \
+           include/QArgumentParser/QArgumentStatistics.hpp \
+           include/QArgumentParser/QArgumentStorage.hpp \
+           include/QArgumentParser/QArgumentToken.hpp \
+           include/QArgumentParser/QArgumentTokenizer.hpp \
+           include/QArgumentParser/QArgumentValue.hpp \
+           include/QArgumentParser/QArgumentBinding.inl \
+           include/QArgumentParser/QArgumentList.inl \
+           include/QArgumentParser/QArgumentOption.inl \
+           include/QArgumentParser/QArgumentOptionView.inl \
+           include/QArgumentParser/QArgumentParser.inl \
+           include/QArgumentParser/QArgumentSchema.inl \
+           include/QArgumentParser/QArgumentToken.inl \
+           include/QArgumentParser/QArgumentValue.inl \
+           src/QArgumentRunnable.hpp
 
 ###########################################################
 # SOURCE FILES
 #
 ###########################################################
-SOURCES += src/QArgumentOption.cpp \
+SOURCES += src/QArgumentArena.cpp \
+           src/QArgumentBinding.cpp \
+           src/QArgumentConfigFile.cpp \
+           src/QArgumentError.cpp \
+           src/QArgumentFileCache.cpp \
+           src/QArgumentMappedFile.cpp \
+           src/QArgumentOption.cpp \
+           src/QArgumentOptionView.cpp \
            src/QArgumentParser.cpp \
+           src/QArgumentSchema.cpp \
+           src/QArgumentSnapshot.cpp \
+           src/QArgumentStatistics.cpp \
+           src/QArgumentStorage.cpp \
+           src/QArgumentToken.cpp \
+           src/QArgumentTokenizer.cpp \
            src/QArgumentValidator.cpp \
-           src/QArgumentValidatorOption.cpp
+           src/QArgumentValidatorOption.cpp \
+           src/QArgumentValue.cpp
 
 ################################################################################
 ## OUTPUT
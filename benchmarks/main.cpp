@@ -0,0 +1,809 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <QArgumentParser/QArgumentParser.hpp>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QThread>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <vector>
+
+#if defined(Q_OS_WIN)
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+    #include <unistd.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Counts every heap allocation made by the process.
+////////////////////////////////////////////////////////////////////////////////
+static std::atomic<quint64> g_allocations(0);
+static std::atomic<quint64> g_allocatedBytes(0);
+
+void* operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    void* memory = std::malloc(size != 0 ? size : 1);
+    if (memory == nullptr)
+    {
+        std::abort();
+    }
+
+    return memory;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Retrieves the peak resident set size of the process in KiB.
+////////////////////////////////////////////////////////////////////////////////
+static qint64 peakResidentKiB()
+{
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return -1;
+
+    return static_cast<qint64>(counters.PeakWorkingSetSize / 1024);
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return -1;
+
+    #if defined(Q_OS_MACOS)
+        return static_cast<qint64>(usage.ru_maxrss / 1024); // bytes on macOS
+    #else
+        return static_cast<qint64>(usage.ru_maxrss);
+    #endif
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Retrieves the maximum size of the argument list passed to a new process.
+////////////////////////////////////////////////////////////////////////////////
+static qint64 maxArgumentBytes()
+{
+#if defined(Q_OS_WIN)
+    return 32767; // CreateProcess command line limit
+#else
+    auto size = sysconf(_SC_ARG_MAX);
+    return size > 0 ? static_cast<qint64>(size) : 131072;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Holds an argument list in the shape of argv.
+////////////////////////////////////////////////////////////////////////////////
+struct ArgumentList
+{
+    std::vector<QByteArray>  storage;
+    std::vector<const char*> pointers;
+
+    void append(const QByteArray& argument)
+    {
+        storage.push_back(argument);
+    }
+
+    void finish()
+    {
+        pointers.clear();
+        for (const auto& argument : storage)
+        {
+            pointers.push_back(argument.constData());
+        }
+    }
+
+    int count() const
+    {
+        return static_cast<int>(pointers.size());
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Runs 'work' for the given amount of iterations and prints one JSON record.
+// If each iteration handles 'tokens' tokens, the throughput is printed, too.
+////////////////////////////////////////////////////////////////////////////////
+static void measure(
+    const char* name,
+    int iterations,
+    const std::function<void()>& work,
+    qint64 tokens = 0)
+{
+    // Warms up caches and lazily initialized state.
+    work();
+
+    auto allocations = g_allocations.load();
+    auto bytes = g_allocatedBytes.load();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int i = 0; i < iterations; i++)
+    {
+        work();
+    }
+
+    auto nanoseconds = timer.nsecsElapsed();
+    allocations = g_allocations.load() - allocations;
+    bytes = g_allocatedBytes.load() - bytes;
+
+    std::printf(
+        "{\"name\":\"%s\",\"iterations\":%d,\"ns_per_iteration\":%.1f,"
+        "\"allocations_per_iteration\":%.2f,\"allocated_bytes_per_iteration\":%.1f,"
+        "\"peak_rss_kib\":%lld",
+        name,
+        iterations,
+        static_cast<double>(nanoseconds) / iterations,
+        static_cast<double>(allocations) / iterations,
+        static_cast<double>(bytes) / iterations,
+        static_cast<long long>(peakResidentKiB()));
+
+    if (tokens > 0)
+    {
+        std::printf(
+            ",\"tokens_per_second\":%.0f",
+            static_cast<double>(tokens) * iterations * 1e9 / qMax<qint64>(nanoseconds, 1));
+    }
+
+    std::printf("}\n");
+
+    std::fflush(stdout);
+}
+
+// Keeps the compiler from discarding results.
+static volatile qint64 g_sink = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// parse() with a growing argv: '-n <int>' pairs, up to ARG_MAX bytes.
+////////////////////////////////////////////////////////////////////////////////
+static void benchmarkArgumentCount()
+{
+    QArgumentValidator validator;
+    QArgumentValidatorOption number("n");
+
+    number.addArgument("value", QArgumentValidatorOption::Int32);
+    validator.addOption(number);
+
+    struct Case { const char* name; qint64 count; int iterations; };
+    const Case cases[] =
+    {
+        { "parse/argc=10",      10,     100000 },
+        { "parse/argc=1000",    1000,   1000   },
+        { "parse/argc=100000",  100000, 10     },
+        { "parse/argc=ARG_MAX", -1,     10     }
+    };
+
+    for (const auto& c : cases)
+    {
+        ArgumentList list;
+
+        // "-n\0" and "12345\0" take 9 bytes plus two pointers per pair.
+        auto count = c.count;
+        if (count < 0)
+        {
+            auto pairSize = 9 + 2 * static_cast<qint64>(sizeof(char*));
+            count = (maxArgumentBytes() / pairSize) * 2;
+        }
+
+        for (qint64 i = 0; i < count; i += 2)
+        {
+            list.append("-n");
+            list.append(QByteArray::number(static_cast<int>(10000 + i % 90000)));
+        }
+
+        list.finish();
+
+        QArgumentParser parser(0, nullptr);
+        parser.setValidator(validator);
+
+        measure(c.name, c.iterations, [&]()
+        {
+            g_sink += parser.parse(list.pointers.data(), list.count());
+        });
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Failing parses: the error record alone, its message and collecting all errors.
+////////////////////////////////////////////////////////////////////////////////
+static void benchmarkErrors()
+{
+    QArgumentValidator validator;
+    QArgumentValidatorOption number("n");
+
+    number.addArgument("value", QArgumentValidatorOption::Int32);
+    validator.addOption(number);
+
+    // Every tenth argument is not a number.
+    ArgumentList list;
+    for (int i = 0; i < 1000; i += 2)
+    {
+        list.append("-n");
+        list.append(i % 10 == 8 ? QByteArray("x") : QByteArray::number(i));
+    }
+
+    list.finish();
+
+    QArgumentParser parser(0, nullptr);
+    parser.setValidator(validator);
+
+    measure("errors/first/code", 10000, [&]()
+    {
+        parser.parse(list.pointers.data(), list.count());
+        g_sink += parser.error().code();
+    });
+
+    measure("errors/first/message", 10000, [&]()
+    {
+        parser.parse(list.pointers.data(), list.count());
+        g_sink += parser.errorMessage().size();
+    });
+
+    parser.setErrorCollectionEnabled(true);
+
+    measure("errors/collect/code", 1000, [&]()
+    {
+        parser.parse(list.pointers.data(), list.count());
+        g_sink += parser.errors().size();
+    }, list.count());
+
+    measure("errors/collect/message", 1000, [&]()
+    {
+        parser.parse(list.pointers.data(), list.count());
+        g_sink += parser.errorMessage().size();
+    }, list.count());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// parse() with validators declaring 1 to 1000 options, each given once.
+////////////////////////////////////////////////////////////////////////////////
+static void benchmarkOptionCount()
+{
+    const int counts[] = { 1, 10, 100, 1000 };
+
+    for (int count : counts)
+    {
+        QArgumentValidator validator;
+        ArgumentList list;
+
+        for (int i = 0; i < count; i++)
+        {
+            auto name = QString("option%0").arg(i);
+            QArgumentValidatorOption option(name);
+
+            option.addArgument("value", QArgumentValidatorOption::Int32);
+            validator.addOption(option);
+
+            list.append("-" + name.toUtf8());
+            list.append(QByteArray::number(i));
+        }
+
+        list.finish();
+
+        QArgumentParser parser(0, nullptr);
+        parser.setValidator(validator);
+
+        auto name = QString("options/count=%0").arg(count).toUtf8();
+        measure(name.constData(), qMax(10, 100000 / count), [&]()
+        {
+            g_sink += parser.parse(list.pointers.data(), list.count());
+        });
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Completion requests and abbreviated options against 1000 declared options.
+////////////////////////////////////////////////////////////////////////////////
+static void benchmarkCompletion(const QByteArray& executable)
+{
+    QArgumentValidator validator;
+    for (int i = 0; i < 1000; i++)
+    {
+        QArgumentValidatorOption option(QString("option%0").arg(i));
+        option.addArgument("path", QArgumentValidatorOption::File);
+        validator.addOption(option);
+    }
+
+    QArgumentParser parser(0, nullptr);
+    parser.setValidator(validator);
+    parser.setAbbreviationEnabled(true);
+    parser.setCompletionEnabled(true);
+
+    // "-option99" matches "-option99" and "-option990" to "-option999".
+    const char* options[] = { "--complete", "-option99" };
+    const char* paths[] = { "--complete", "-option1", "./" };
+    const char* abbreviated[] = { "-option99", executable.constData() };
+
+    measure("complete/options", 100000, [&]()
+    {
+        parser.parse(options, 2);
+        g_sink += parser.completions().size();
+    });
+
+    measure("complete/paths", 1000, [&]()
+    {
+        parser.parse(paths, 3);
+        g_sink += parser.completions().size();
+    });
+
+    measure("abbreviation/exact", 100000, [&]()
+    {
+        g_sink += parser.parse(abbreviated, 2);
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Declares the 20 options of the given subcommand of benchmarkSubcommands().
+////////////////////////////////////////////////////////////////////////////////
+static void declareOptions(QArgumentValidator* validator, int subcommand)
+{
+    for (int i = 0; i < 20; i++)
+    {
+        QArgumentValidatorOption option(QString("c%0o%1").arg(subcommand).arg(i));
+        option.addArgument("value", QArgumentValidatorOption::Int32);
+        validator->addOption(option);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Start-up of a tool with 40 subcommands of 20 options each: one flat
+// validator declaring all of them versus lazily built subcommand validators.
+////////////////////////////////////////////////////////////////////////////////
+static void benchmarkSubcommands()
+{
+    const char* arguments[] = { "c39", "-c39o0", "1", "-c39o19", "2" };
+    const char* flatArguments[] = { "-c39o0", "1", "-c39o19", "2" };
+
+    measure("subcommands/flat", 100, [&]()
+    {
+        QArgumentValidator validator;
+        for (int i = 0; i < 40; i++)
+        {
+            declareOptions(&validator, i);
+        }
+
+        QArgumentParser parser(0, nullptr);
+        parser.setValidator(validator);
+        g_sink += parser.parse(flatArguments, 4);
+    });
+
+    measure("subcommands/lazy", 100, [&]()
+    {
+        QArgumentParser parser(0, nullptr);
+        for (int i = 0; i < 40; i++)
+        {
+            parser.addSubcommand(QString("c%0").arg(i), [i](QArgumentValidator* validator)
+            {
+                declareOptions(validator, i);
+            });
+        }
+
+        g_sink += parser.parse(arguments, 5);
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// parse() of an ARG_MAX sized argv with 1 to 64 validating threads.
+////////////////////////////////////////////////////////////////////////////////
+static void benchmarkParseThreads()
+{
+    QArgumentValidator validator;
+    QArgumentValidatorOption record("r");
+
+    record.addArgument("id", QArgumentValidatorOption::UInt64);
+    record.addArgument("offset", QArgumentValidatorOption::Int64);
+    record.addArgument("count", QArgumentValidatorOption::Int32);
+    validator.addOption(record);
+
+    // "-r\0" takes 3 bytes, each number 11; four pointers per option.
+    ArgumentList list;
+    auto optionSize = 3 + 3 * 11 + 4 * static_cast<qint64>(sizeof(char*));
+    auto count = maxArgumentBytes() / optionSize;
+
+    for (qint64 i = 0; i < count; i++)
+    {
+        list.append("-r");
+        list.append(QByteArray::number(Q_UINT64_C(1000000000) + i));
+        list.append(QByteArray::number(Q_INT64_C(-1000000000) - i));
+        list.append(QByteArray::number(static_cast<int>(1000000000 + i % 1000)));
+    }
+
+    list.finish();
+
+    const int threadCounts[] = { 1, 2, 4, 8, 16, 32, 64 };
+    for (int threads : threadCounts)
+    {
+        if (threads > 1 && threads / 2 >= QThread::idealThreadCount())
+        {
+            break;
+        }
+
+        QArgumentParser parser(0, nullptr);
+        parser.setValidator(validator);
+        parser.setParseThreadCount(threads);
+
+        auto name = QString("parse/threads=%0").arg(threads).toUtf8();
+        measure(name.constData(), 10, [&]()
+        {
+            g_sink += parser.parse(list.pointers.data(), list.count());
+        });
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// validateBatch() of 10000 small command lines with 1 to 64 threads.
+////////////////////////////////////////////////////////////////////////////////
+static void benchmarkBatch()
+{
+    QArgumentValidator validator;
+    QArgumentValidatorOption number("n");
+    QArgumentValidatorOption text("s");
+    QArgumentValidatorOption verbose("v");
+
+    number.addArgument("value", QArgumentValidatorOption::Int32);
+    text.addArgument("value", QArgumentValidatorOption::String);
+    validator.addOption(number);
+    validator.addOption(text);
+    validator.addOption(verbose);
+
+    // 20 arguments each; every hundredth command line has an invalid number.
+    QVector<QStringList> jobs;
+    qint64 tokens = 0;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        QStringList job;
+        for (int j = 0; j < 6; j++)
+        {
+            job << "-n" << (i % 100 == 99 && j == 0 ? QString("x") : QString::number(i + j));
+            job << "-s" << QString("job%0").arg(i);
+        }
+
+        job << "-v" << "-v" << "-v" << "-v";
+        tokens += job.size();
+        jobs.append(job);
+    }
+
+    const int threadCounts[] = { 1, 2, 4, 8, 16, 32, 64 };
+    for (int threads : threadCounts)
+    {
+        if (threads > 1 && threads / 2 >= QThread::idealThreadCount())
+        {
+            break;
+        }
+
+        QArgumentParser parser(0, nullptr);
+        parser.setValidator(validator);
+        parser.setBatchThreadCount(threads);
+
+        auto name = QString("batch/threads=%0").arg(threads).toUtf8();
+        measure(name.constData(), 10, [&]()
+        {
+            g_sink += parser.validateBatch(jobs).size();
+        }, tokens);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Shell-style splitting of a single command line, alone and while parsing.
+////////////////////////////////////////////////////////////////////////////////
+static void benchmarkCommandLine()
+{
+    QArgumentValidator validator;
+    QArgumentValidatorOption number("n");
+    QArgumentValidatorOption text("s");
+
+    number.addArgument("value", QArgumentValidatorOption::Int32);
+    text.addArgument("value", QArgumentValidatorOption::String);
+    validator.addOption(number);
+    validator.addOption(text);
+
+    // Plain, quoted and escaped arguments plus a comment every 100 lines.
+    struct Case { const char* name; const char* pattern; };
+    const Case cases[] =
+    {
+        { "plain",   "-n %0 -s value%0\n"                     },
+        { "quoted",  "-n '%0' -s \"some value %0\"\n"         },
+        { "escaped", "-n %0 -s some\\ \"value \\\"%0\\\"\"\n" }
+    };
+
+    const qint64 lines = 25000;
+    for (const auto& c : cases)
+    {
+        QString commandLine;
+        for (qint64 i = 0; i < lines; i++)
+        {
+            commandLine += QString(c.pattern).arg(i);
+            if (i % 100 == 0)
+            {
+                commandLine += QStringLiteral("# comment\n");
+            }
+        }
+
+        QArgumentTokenizer tokenizer(QArgumentTokenizer::Shell);
+        QVector<QByteArray> storage;
+        QArgumentToken token;
+
+        tokenizer.setStorage(&storage);
+        tokenizer.setCommentCharacter('#');
+
+        auto name = QString("tokenize/%0").arg(c.name).toUtf8();
+        measure(name.constData(), 100, [&]()
+        {
+            storage.clear();
+            tokenizer.setData(commandLine);
+
+            while (tokenizer.next(&token))
+            {
+                g_sink += token.size();
+            }
+        }, lines * 4);
+
+        QArgumentParser parser(0, nullptr);
+        parser.setValidator(validator);
+
+        name = QString("parse/command_line/%0").arg(c.name).toUtf8();
+        measure(name.constData(), 100, [&]()
+        {
+            g_sink += parser.parse(commandLine, '#');
+        }, lines * 4);
+
+        parser.setArenaEnabled(true);
+
+        name = QString("parse/command_line/%0/arena").arg(c.name).toUtf8();
+        measure(name.constData(), 100, [&]()
+        {
+            g_sink += parser.parse(commandLine, '#');
+        }, lines * 4);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Loading a config file of 10000 keys, from its text and from a snapshot.
+////////////////////////////////////////////////////////////////////////////////
+static void benchmarkConfigFiles()
+{
+    const int keys = 10000;
+    auto directory = QDir::tempPath() + QStringLiteral("/qargumentparser-benchmark");
+    QDir().mkpath(directory);
+
+    QByteArray ini;
+    for (int i = 0; i < keys; i++)
+    {
+        if (i % 100 == 0)
+        {
+            ini += "[section" + QByteArray::number(i / 100) + "]\n";
+        }
+
+        ini += "key" + QByteArray::number(i) + " = " + QByteArray::number(i) + " 'some value'\n";
+    }
+
+    auto path = directory + QStringLiteral("/config.ini");
+    auto snapshot = directory + QStringLiteral("/config.snapshot");
+
+    QFile file(path);
+    if (!file.open(QFile::WriteOnly) || file.write(ini) != ini.size())
+    {
+        return;
+    }
+
+    file.close();
+
+    measure("config/load/ini", 100, [&]()
+    {
+        QArgumentConfigFile config;
+        g_sink += config.load(path);
+    });
+
+    QArgumentConfigFile config;
+    if (config.load(path) && config.saveSnapshot(snapshot))
+    {
+        measure("config/load/snapshot", 100, [&]()
+        {
+            QArgumentConfigFile cached;
+            g_sink += cached.load(path, QArgumentConfigFile::Auto, snapshot) && cached.isFromSnapshot();
+        });
+    }
+
+    QFile::remove(snapshot);
+    QFile::remove(path);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// validate() for every argument type.
+////////////////////////////////////////////////////////////////////////////////
+static void benchmarkArgumentTypes(const QByteArray& executable)
+{
+    struct Case
+    {
+        const char*                            name;
+        QArgumentValidatorOption::ArgumentType type;
+        QByteArray                             argument;
+        int                                    iterations;
+    };
+
+    const Case cases[] =
+    {
+        { "validate/Char",       QArgumentValidatorOption::Char,       "x",                    1000000 },
+        { "validate/UInt8",      QArgumentValidatorOption::UInt8,      "200",                  1000000 },
+        { "validate/Int16",      QArgumentValidatorOption::Int16,      "-12345",               1000000 },
+        { "validate/UInt16",     QArgumentValidatorOption::UInt16,     "54321",                1000000 },
+        { "validate/Int32",      QArgumentValidatorOption::Int32,      "-1234567890",          1000000 },
+        { "validate/UInt32",     QArgumentValidatorOption::UInt32,     "4012345678",           1000000 },
+        { "validate/Int64",      QArgumentValidatorOption::Int64,      "-1234567890123456789", 1000000 },
+        { "validate/UInt64",     QArgumentValidatorOption::UInt64,     "12345678901234567890", 1000000 },
+        { "validate/String",     QArgumentValidatorOption::String,     "some text",            1000000 },
+        { "validate/File",       QArgumentValidatorOption::File,       executable,             100000  },
+        { "validate/Directory",  QArgumentValidatorOption::Directory,  ".",                    100000  },
+        { "validate/MappedFile", QArgumentValidatorOption::MappedFile, executable,             10000   }
+    };
+
+    for (const auto& c : cases)
+    {
+        QArgumentValidator validator;
+        QArgumentValidatorOption option("o");
+
+        option.addArgument("value", c.type);
+        validator.addOption(option);
+        validator.compile();
+
+        QVector<QArgumentToken> tokens;
+        QVector<QArgumentValue> values;
+        QString message;
+
+        tokens.append(QArgumentToken::fromUtf8(c.argument.constData(), c.argument.size()));
+
+        measure(c.name, c.iterations, [&]()
+        {
+            g_sink += validator.validate(0, tokens, &message, &values);
+        });
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Repeated argument<T>() access on a parsed option.
+////////////////////////////////////////////////////////////////////////////////
+static void benchmarkArgumentAccess()
+{
+    QArgumentValidator validator;
+    QArgumentValidatorOption option("o");
+
+    option.addArgument("int", QArgumentValidatorOption::Int32);
+    option.addArgument("long", QArgumentValidatorOption::Int64);
+    option.addArgument("text", QArgumentValidatorOption::String);
+    validator.addOption(option);
+
+    const char* arguments[] = { "-o", "-42", "1234567890123", "some text" };
+
+    QArgumentParser parser(0, nullptr);
+    parser.setValidator(validator);
+    parser.parse(arguments, 4);
+
+    const QArgumentOption parsed = parser.option("o");
+
+    measure("access/option", 1000000, [&]()
+    {
+        g_sink += parser.option("o").argument<int>(0);
+    });
+
+    measure("access/option_view", 1000000, [&]()
+    {
+        g_sink += parser.optionView("o").argument<int>(0);
+    });
+
+    measure("access/iterate", 1000000, [&]()
+    {
+        for (QArgumentOptionView view : parser)
+        {
+            for (const QArgumentValue& value : view)
+            {
+                g_sink += value.token().size();
+            }
+        }
+    });
+
+    measure("access/int/index", 10000000, [&]()
+    {
+        g_sink += parsed.argument<int>(0);
+    });
+
+    measure("access/int/name", 1000000, [&]()
+    {
+        g_sink += parsed.argument<int>("int");
+    });
+
+    measure("access/qint64/name", 1000000, [&]()
+    {
+        g_sink += parsed.argument<qint64>("long");
+    });
+
+    measure("access/QString/name", 1000000, [&]()
+    {
+        g_sink += parsed.argument<QString>("text").size();
+    });
+
+    measure("snapshot/create", 100000, [&]()
+    {
+        g_sink += parser.snapshot()->optionCount();
+    });
+
+    // Readers load the published snapshot and look up an option each time.
+    std::shared_ptr<const QArgumentSnapshot> published = parser.snapshot();
+
+    measure("snapshot/read", 1000000, [&]()
+    {
+        auto snapshot = std::atomic_load(&published);
+        g_sink += snapshot->optionView("o").argument<int>("int");
+    });
+}
+
+int main(int argc, char* argv[])
+{
+    QByteArray executable = argc > 0 ? QByteArray(argv[0]) : QByteArray(".");
+
+    benchmarkArgumentCount();
+    benchmarkErrors();
+    benchmarkOptionCount();
+    benchmarkSubcommands();
+    benchmarkCompletion(executable);
+    benchmarkParseThreads();
+    benchmarkBatch();
+    benchmarkCommandLine();
+    benchmarkConfigFiles();
+    benchmarkArgumentTypes(executable);
+    benchmarkArgumentAccess();
+
+    return 0;
+}
@@ -32,7 +32,7 @@ int main(int argc, char *argv[])
     QArgumentValidatorOption file("file"), amount("amount");
 
     // Builds the validator.
-    file.addArgument("f", QArgumentValidatorOption::File);
+    file.addArgument("f", QArgumentValidatorOption::MappedFile);
     amount.addArgument("s", QArgumentValidatorOption::Int64);
     validator.addOption(file);
     validator.addOption(amount);
@@ -53,15 +53,15 @@ int main(int argc, char *argv[])
         auto fileOption = parser.option("file");
         auto sizeOption = parser.option("amount");
 
-        QFile*  file = fileOption.argument<QFile*>("f");
-        qint64  size = sizeOption.argument<qint64>("s");
-        QString base = "Reading %1 bytes from \"%0\":\n";
+        QString    path = fileOption.argument<QString>("f");
+        QByteArray data = fileOption.argument<QByteArray>("f");
+        qint64     size = qMin<qint64>(sizeOption.argument<qint64>("s"), data.size());
+        QString    base = "Reading %1 bytes from \"%0\":\n";
 
-        file->open(QFile::ReadOnly);
-
-        qDebug().noquote() << QString(base).arg(file->fileName(), QString::number(size));
+        // The file is mapped, not read; 'data' views the mapping.
+        qDebug().noquote() << QString(base).arg(path, QString::number(size));
         qDebug().noquote() << "-------- start --------";
-        qDebug().noquote() << QString(file->read(size));
+        qDebug().noquote() << QString::fromUtf8(data.constData(), static_cast<int>(size));
         qDebug().noquote() << "--------- end ---------";
     }
 
@@ -58,6 +58,13 @@
     #define QARGUMENTPARSER_CONSTEXPR constexpr
 #endif
 
+#if defined(QARGUMENTPARSER_NO_STATISTICS)
+    // Removes the statistics hooks from the library entirely.
+    #define QARGUMENTPARSER_STATISTICS(...)
+#else
+    #define QARGUMENTPARSER_STATISTICS(...) __VA_ARGS__
+#endif
+
 // Snippets put into the anonymous namespace.
 #define Anonymous(...) namespace { __VA_ARGS__; }
 
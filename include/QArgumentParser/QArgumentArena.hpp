@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTARENA_HPP
+#define QARGUMENTPARSER_QARGUMENTARENA_HPP
+
+#include <QArgumentParser/Config.hpp>
+
+#include <QByteArray>
+#include <QVector>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentArena
+/// \brief Allocates the strings of one parse from a few large blocks.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+class QARGUMENTPARSER_API QArgumentArena
+{
+public:
+
+    QArgumentArena();
+    QArgumentArena(const QArgumentArena& other);
+    QArgumentArena& operator=(const QArgumentArena& other);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the block size new arenas are created with.
+    ///
+    /// \return The default block size, in bytes.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    static int defaultBlockSize();
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the size of the blocks allocated by this arena.
+    ///
+    /// \return The block size, in bytes.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int blockSize() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the amount of blocks currently owned by this arena.
+    ///
+    /// \return The amount of blocks.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int blockCount() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the total size of all blocks owned by this arena.
+    ///
+    /// \return The capacity, in bytes.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    qint64 capacity() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the size of the blocks allocated from now on. Blocks that
+    /// already exist keep their size.
+    ///
+    /// \param[in] size The block size, in bytes.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setBlockSize(int size);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Allocates \p size bytes, aligned for any integral type. Requests
+    /// larger than a block get a block of their own.
+    ///
+    /// \param[in] size The amount of bytes to allocate.
+    /// \return The allocated memory, valid until the arena is cleared.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    char* allocate(int size);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Copies \p size bytes at \p data into the arena, unless identical bytes
+    /// have been interned before; the earlier copy is returned then.
+    ///
+    /// \param[in] data The bytes to intern.
+    /// \param[in] size The amount of bytes.
+    /// \return The interned bytes, valid until the arena is cleared.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const char* intern(const char* data, int size);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves an empty buffer for building a value before interning it.
+    /// The buffer keeps its capacity and is reused by the next call.
+    ///
+    /// \return The buffer.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QByteArray* scratch();
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Frees everything allocated at once. The blocks are kept and reused;
+    /// only blocks larger than the block size are released.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void clear();
+
+private:
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        const char* data;
+        int         size;
+        uint        hash;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    void rehash(int);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    QVector<QByteArray> m_blocks;
+    QVector<QByteArray> m_largeBlocks;
+    QVector<Entry>      m_entries;
+    QVector<int>        m_buckets;
+    QByteArray          m_scratch;
+    int                 m_blockSize;
+    int                 m_currentBlock;
+    int                 m_used;
+};
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentArena
+///
+/// A monotonic allocator: allocations only move a pointer forward within the
+/// current block and are never freed one by one. QArgumentArena::clear frees
+/// all of them at once and rewinds to the first block, so a parser reusing
+/// its arena stops allocating once the blocks suffice for its input.
+///
+/// Interned values are looked up by their bytes; a value given many times is
+/// stored once. Copies of an arena share the blocks of the original, which
+/// thus stay valid as long as either exists, and allocate from new ones.
+///
+////////////////////////////////////////////////////////////////////////////////
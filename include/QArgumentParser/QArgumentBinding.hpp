@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTBINDING_HPP
+#define QARGUMENTPARSER_QARGUMENTBINDING_HPP
+
+#include <QArgumentParser/QArgumentList.hpp>
+#include <QArgumentParser/QArgumentValue.hpp>
+
+#include <QDir>
+#include <QStringList>
+#include <functional>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentBinding
+/// \brief Binds an argument to a data member of a user-defined structure.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+class QARGUMENTPARSER_API QArgumentBinding
+{
+public:
+
+    QArgumentBinding();
+    QArgumentBinding(const QArgumentBinding& other) = default;
+    QArgumentBinding& operator=(const QArgumentBinding& other) = default;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Binds the argument \p argument of the option \p option to \p member.
+    /// Supported member types as of today: char, uchar, short, ushort, int,
+    /// uint, qint64, quint64, QString, QArgumentToken, QDir, QByteArray and
+    /// QSharedPointer<const QArgumentMappedFile>; for list arguments
+    /// QArgumentList and QVector of qint32, quint64 or QArgumentToken, and
+    /// QStringList.
+    ///
+    /// \param[in] option The name of the option.
+    /// \param[in] argument The name of the argument.
+    /// \param[in] member The data member receiving the converted argument.
+    /// \return The new binding.
+    ///
+    /// \remarks QByteArray members receive a copy of the mapped contents;
+    ///          bind QSharedPointer<const QArgumentMappedFile> to avoid it.
+    ///          QArgumentToken members, and the elements of token lists, view
+    ///          the parser's input and are valid until it parses again or is
+    ///          destroyed.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename Struct, typename T>
+    static QArgumentBinding create(
+        const QString& option,
+        const QString& argument,
+        T Struct::* member);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Binds the presence of the option \p option to \p member, which is set
+    /// to 'true' whenever the option is given.
+    ///
+    /// \param[in] option The name of the option.
+    /// \param[in] member The data member receiving the presence of the option.
+    /// \return The new binding.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename Struct>
+    static QArgumentBinding create(const QString& option, bool Struct::* member);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves a key identifying the structure type \p Struct.
+    ///
+    /// \return The key of the structure type.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename Struct> static const void* structure();
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the name of the bound option.
+    ///
+    /// \return The option.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QString& option() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the name of the bound argument.
+    ///
+    /// \return The argument, or a null QString if the presence is bound.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QString& argument() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the key of the structure type this binding writes to.
+    ///
+    /// \return The key, as returned by QArgumentBinding::structure.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const void* structureKey() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Converts \p value and writes it to the bound member of \p target.
+    ///
+    /// \param[in] target The structure to write to.
+    /// \param[in] value The validated argument.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void assign(void* target, const QArgumentValue& value) const;
+
+private:
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////////////////////
+    typedef std::function<void(void*, const QArgumentValue&)> Assignment;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentBinding(const QString&, const QString&, const void*, const Assignment&);
+    static void convert(const QArgumentValue&, char*);
+    static void convert(const QArgumentValue&, uchar*);
+    static void convert(const QArgumentValue&, short*);
+    static void convert(const QArgumentValue&, ushort*);
+    static void convert(const QArgumentValue&, int*);
+    static void convert(const QArgumentValue&, uint*);
+    static void convert(const QArgumentValue&, qint64*);
+    static void convert(const QArgumentValue&, quint64*);
+    static void convert(const QArgumentValue&, QString*);
+    static void convert(const QArgumentValue&, QArgumentToken*);
+    static void convert(const QArgumentValue&, QDir*);
+    static void convert(const QArgumentValue&, QByteArray*);
+    static void convert(const QArgumentValue&, QSharedPointer<const QArgumentMappedFile>*);
+    static void convert(const QArgumentValue&, QArgumentList<qint32>*);
+    static void convert(const QArgumentValue&, QArgumentList<quint64>*);
+    static void convert(const QArgumentValue&, QArgumentList<QArgumentToken>*);
+    static void convert(const QArgumentValue&, QVector<qint32>*);
+    static void convert(const QArgumentValue&, QVector<quint64>*);
+    static void convert(const QArgumentValue&, QVector<QArgumentToken>*);
+    static void convert(const QArgumentValue&, QStringList*);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    QString     m_option;
+    QString     m_argument;
+    const void* m_structure;
+    Assignment  m_assignment;
+};
+
+// Template definitions
+#include "QArgumentBinding.inl"
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentBinding
+///
+/// Bindings are usually created through QArgumentParser::bind. The member
+/// pointer is captured once; while parsing, the validated argument is written
+/// to the member directly, without creating a QArgumentOption or looking the
+/// argument up by name.
+///
+////////////////////////////////////////////////////////////////////////////////
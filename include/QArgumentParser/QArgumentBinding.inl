@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QARGUMENTPARSER_QARGUMENTBINDING_INL
+#define QARGUMENTPARSER_QARGUMENTBINDING_INL
+
+template<typename Struct, typename T>
+inline QArgumentBinding QArgumentBinding::create(
+    const QString& option,
+    const QString& argument,
+    T Struct::* member)
+{
+    return QArgumentBinding(option, argument, structure<Struct>(),
+        [member](void* target, const QArgumentValue& value)
+        {
+            convert(value, &(static_cast<Struct*>(target)->*member));
+        });
+}
+
+template<typename Struct>
+inline QArgumentBinding QArgumentBinding::create(const QString& option, bool Struct::* member)
+{
+    return QArgumentBinding(option, QString(), structure<Struct>(),
+        [member](void* target, const QArgumentValue&)
+        {
+            static_cast<Struct*>(target)->*member = true;
+        });
+}
+
+template<typename Struct>
+inline const void* QArgumentBinding::structure()
+{
+    // Every instantiation owns a distinct object; its address is the key.
+    static const char key = 0;
+    return &key;
+}
+
+#endif
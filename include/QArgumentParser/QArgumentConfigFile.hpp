@@ -0,0 +1,235 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTCONFIGFILE_HPP
+#define QARGUMENTPARSER_QARGUMENTCONFIGFILE_HPP
+
+#include <QArgumentParser/QArgumentMappedFile.hpp>
+#include <QArgumentParser/QArgumentToken.hpp>
+
+#include <QHash>
+#include <QJsonObject>
+#include <QSharedPointer>
+#include <QVector>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentConfigFile
+/// \brief Reads option arguments from an INI or JSON file.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+class QARGUMENTPARSER_API QArgumentConfigFile
+{
+public:
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the syntax of a config file.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    enum Format
+    {
+        Auto,
+        Ini,
+        Json
+    };
+
+    QArgumentConfigFile();
+    QArgumentConfigFile(const QArgumentConfigFile& other) = default;
+    QArgumentConfigFile& operator=(const QArgumentConfigFile& other) = default;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the path of the loaded config file.
+    ///
+    /// \return The path.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QString& path() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the error message if loading or saving failed.
+    ///
+    /// \return The error message.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QString& errorMessage() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether the entries were read from a snapshot rather than
+    /// from the config file itself.
+    ///
+    /// \return True if a snapshot was used, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isFromSnapshot() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the amount of keys in the config file.
+    ///
+    /// \return The amount of entries.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int entryCount() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the index of the entry with the given \p key.
+    ///
+    /// \param[in] key The key, e.g. "section/name".
+    /// \return The index of the entry, or -1 if there is no such key.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int indexOf(const QString& key) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the key of the entry at \p index.
+    ///
+    /// \param[in] index Index of the entry.
+    /// \return The key.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QString& keyAt(int index) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the amount of arguments of the entry at \p index.
+    ///
+    /// \param[in] index Index of the entry.
+    /// \return The amount of arguments.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int argumentCount(int index) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the arguments of the entry at \p index. They view the file
+    /// wherever possible and stay valid as long as any copy of this instance.
+    ///
+    /// \param[in] index Index of the entry.
+    /// \return Pointer to the first of QArgumentConfigFile::argumentCount
+    ///         arguments.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentToken* arguments(int index) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Loads the config file at \p path. The file is memory-mapped and read
+    /// once; the arguments of INI files view the mapping.
+    ///
+    /// If \p snapshotPath names a snapshot saved for the same version of the
+    /// file, i.e. for the same modification time and size, it is mapped and
+    /// used instead; the file is not read then.
+    ///
+    /// \param[in] path The path of the config file.
+    /// \param[in] format The syntax; Auto chooses by the file extension.
+    /// \param[in] snapshotPath The path of a snapshot, or an empty string.
+    /// \return True if the file was loaded, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool load(
+        const QString& path,
+        Format format = Auto,
+        const QString& snapshotPath = QString());
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Saves the entries as a binary snapshot at \p path, stamped with the
+    /// modification time and size of the config file.
+    ///
+    /// \param[in] path The path of the snapshot.
+    /// \return True if the snapshot was written, false otherwise.
+    ///
+    /// \remarks Save after a successful QArgumentParser::parse, so that the
+    ///          snapshot only holds arguments that passed validation.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool saveSnapshot(const QString& path);
+
+private:
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        QString key;
+        int     offset;
+        int     count;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    void clear();
+    bool loadSnapshot(const QString&);
+    bool parseIni(const char*, int);
+    bool parseJson(const char*, int);
+    bool addJsonObject(const QString&, const QJsonObject&);
+    bool setMalformed(const char*, int);
+    void addEntry(const QString&, int);
+    QArgumentToken keep(const QByteArray&);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    QSharedPointer<const QArgumentMappedFile> m_file;
+    QVector<QByteArray>                       m_storage;
+    QVector<QArgumentToken>                   m_arguments;
+    QVector<Entry>                            m_entries;
+    QHash<QString, int>                       m_entryIndices;
+    QString                                   m_path;
+    QString                                   m_errorMessage;
+    qint64                                    m_modified;
+    qint64                                    m_size;
+    bool                                      m_isFromSnapshot;
+};
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentConfigFile
+///
+/// Config files provide the arguments of options that are not given on the
+/// command line; see QArgumentValidatorOption::setConfigKey. In INI files,
+/// keys within a [section] are prefixed with "section/" and values are split
+/// at whitespace, honouring quotes. Nested JSON objects are flattened the same
+/// way; arrays provide several arguments, 'true' gives an option without
+/// arguments and 'false' or 'null' leave it out.
+///
+/// \code
+/// QArgumentConfigFile config;
+/// if (!config.load("myprogram.ini", QArgumentConfigFile::Auto, "myprogram.cache"))
+/// {
+///     qDebug().noquote() << config.errorMessage();
+/// }
+///
+/// parser.addConfigFile(config);
+/// if (parser.parse() == QArgumentParser::Success && !config.isFromSnapshot())
+/// {
+///     config.saveSnapshot("myprogram.cache");
+/// }
+/// \endcode
+///
+/// Snapshots skip reading the config file on the next start. They are mapped
+/// and their arguments viewed in place, and are ignored as soon as the config
+/// file changes. The arguments are validated on every parse nonetheless, as
+/// files and directories they name may have changed in the meantime.
+///
+////////////////////////////////////////////////////////////////////////////////
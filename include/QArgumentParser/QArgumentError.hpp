@@ -0,0 +1,301 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTERROR_HPP
+#define QARGUMENTPARSER_QARGUMENTERROR_HPP
+
+#include <QArgumentParser/QArgumentToken.hpp>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentError
+/// \brief Describes why an option or its arguments were rejected.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+class QARGUMENTPARSER_API QArgumentError
+{
+public:
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// The cause of an error. The values match the numbers of the messages.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    enum Code
+    {
+        NoError                   = 0,
+        InvalidOption             = 1,
+        InvalidArgumentCount      = 2,
+        InvalidArgumentType       = 3,
+        InvalidChar               = 4,
+        InvalidUInt8              = 5,
+        InvalidInt16              = 6,
+        InvalidUInt16             = 7,
+        InvalidInt32              = 8,
+        InvalidUInt32             = 9,
+        InvalidInt64              = 10,
+        InvalidUInt64             = 11,
+        FileNotFound              = 12,
+        DirectoryNotFound         = 13,
+        MissingRequiredOption     = 14,
+        ResponseFileUnreadable    = 15,
+        ResponseFileTooDeep       = 16,
+        ResponseFileUnterminated  = 17,
+        UnterminatedQuote         = 18,
+        FileNotMappable           = 19,
+        InvalidListCount          = 20,
+        UnknownBoundOption        = 21,
+        UnknownBoundArgument      = 22,
+        FileTooLarge              = 23
+    };
+
+    QArgumentError();
+    QArgumentError(const QArgumentError& other) = default;
+    QArgumentError& operator=(const QArgumentError& other) = default;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Initializes a new error with the given \p code.
+    ///
+    /// \param[in] code The cause of the error.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    explicit QArgumentError(Code code);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the cause of this error.
+    ///
+    /// \return The error code, QArgumentError::NoError for no error.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    Code code() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the option as it appeared in the input.
+    ///
+    /// \return The option token, or an empty token if the option was not
+    ///         read from the input, e.g. a missing required option.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentToken& option() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the name of the option the error refers to. Options known to
+    /// the validator share its name; others are converted from option().
+    ///
+    /// \return The option name, or an empty string if there is none.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QString optionName() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the first argument the error refers to.
+    ///
+    /// \return The argument token, or an empty token if there is none.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentToken& argument() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the index of argument() among the arguments of the option.
+    ///
+    /// \return The argument index, or -1 if the error concerns the option.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int argumentIndex() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the amount of arguments the error refers to, starting at
+    /// argumentIndex(). Errors within lists span all of their elements.
+    ///
+    /// \return The amount of arguments.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int argumentSpan() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the index of the option token in the input. Tokens split off
+    /// a command line or read from response files are counted in the order
+    /// they were read; an '\@path' argument counts as well. Errors that do not
+    /// concern an option may refer to the token they were found at.
+    ///
+    /// \return The token index, or -1 if the option was not read from input.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int position() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the amount of arguments that was given to an option or list
+    /// along with QArgumentError::InvalidArgumentCount and ::InvalidListCount.
+    ///
+    /// \return The amount of arguments given.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int count() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the least amount of arguments expected by the option or list.
+    ///
+    /// \return The minimum amount of arguments.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int minimum() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the greatest amount of arguments expected by the option or
+    /// list.
+    ///
+    /// \return The maximum amount of arguments, or -1 for any amount.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int maximum() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the text not found in the input that the error refers to: the
+    /// name of a list, the path of a deferred file check or the name of a
+    /// bound argument.
+    ///
+    /// \return The detail, or a null string if there is none.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QString& detail() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Formats the human-readable message of this error. Nothing is formatted
+    /// until this function is called.
+    ///
+    /// \return The error message, or an empty string for no error.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QString message() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the cause of this error.
+    ///
+    /// \param[in] code The error code.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setCode(Code code);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the option the error refers to.
+    ///
+    /// \param[in] option The option token as it appeared in the input.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setOption(const QArgumentToken& option);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the name of the option the error refers to.
+    ///
+    /// \param[in] name The name of the option.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setOptionName(const QString& name);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the index of the option token in the input.
+    ///
+    /// \param[in] position The token index, or -1.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setPosition(int position);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the arguments the error refers to.
+    ///
+    /// \param[in] argument The first argument.
+    /// \param[in] index The index of \p argument among those of the option.
+    /// \param[in] span The amount of arguments, starting at \p index.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setArgument(const QArgumentToken& argument, int index = -1, int span = 1);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the amount of arguments given and the expected range.
+    ///
+    /// \param[in] count The amount of arguments given.
+    /// \param[in] minimum The minimum amount of arguments.
+    /// \param[in] maximum The maximum amount of arguments, or -1 for any.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setCount(int count, int minimum, int maximum);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the text not found in the input that the error refers to.
+    ///
+    /// \param[in] detail The list name, path or argument name.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setDetail(const QString& detail);
+
+private:
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    QString path() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    Code           m_code;
+    QArgumentToken m_option;
+    QArgumentToken m_argument;
+    QString        m_optionName;
+    QString        m_detail;
+    int            m_position;
+    int            m_argumentIndex;
+    int            m_argumentSpan;
+    int            m_count;
+    int            m_minimum;
+    int            m_maximum;
+};
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentError
+///
+/// QArgumentValidator and QArgumentParser report failures as error records
+/// rather than as text. A record holds the error code and views the offending
+/// tokens in the input; names known to the validator are shared with it. The
+/// message is only formatted by QArgumentError::message, so tools that react
+/// to the code or point at the argument never pay for building strings:
+///
+/// \code
+/// if (parser.parse() == QArgumentParser::Failure)
+/// {
+///     for (const QArgumentError& error : parser.errors())
+///     {
+///         if (error.code() == QArgumentError::FileNotFound)
+///             // [offer to create the file at error.argument()]
+///         else
+///             qDebug().noquote() << error.message();
+///     }
+/// }
+/// \endcode
+///
+/// The tokens of an error view the same input as the parsed options, and are
+/// valid as long as those would be.
+///
+////////////////////////////////////////////////////////////////////////////////
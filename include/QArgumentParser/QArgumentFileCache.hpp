@@ -0,0 +1,196 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTFILECACHE_HPP
+#define QARGUMENTPARSER_QARGUMENTFILECACHE_HPP
+
+#include <QArgumentParser/QArgumentError.hpp>
+#include <QArgumentParser/QArgumentValidatorOption.hpp>
+
+#include <QFileInfo>
+#include <QHash>
+#include <QVector>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentFileCache
+/// \brief Batches, deduplicates and caches file system checks of arguments.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+class QARGUMENTPARSER_API QArgumentFileCache
+{
+public:
+
+    QArgumentFileCache();
+    QArgumentFileCache(const QArgumentFileCache& other) = default;
+    QArgumentFileCache& operator=(const QArgumentFileCache& other) = default;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the maximum amount of threads checking paths concurrently.
+    /// By default, this is QThread::idealThreadCount.
+    ///
+    /// \return The maximum amount of threads.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int maxThreadCount() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the amount of checks added since the cache was cleared.
+    ///
+    /// \return The amount of checks.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int checkCount() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the path of the check at the given \p index.
+    ///
+    /// \param[in] index The index of the check, in the order they were added.
+    /// \return The path to check.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QString& checkPath(int index) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the expected type of the check at the given \p index.
+    ///
+    /// \param[in] index The index of the check, in the order they were added.
+    /// \return Either QArgumentValidatorOption::File or ::Directory.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentValidatorOption::ArgumentType checkType(int index) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the error to report if the check at the given \p index fails.
+    ///
+    /// \param[in] index The index of the check, in the order they were added.
+    /// \return The error given to QArgumentFileCache::addCheck.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentError& checkError(int index) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the information about the file at \p path. Paths that were
+    /// checked already are not queried again.
+    ///
+    /// \param[in] path The path of the file.
+    /// \return The cached or, for unknown paths, a new QFileInfo.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QFileInfo info(const QString& path) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the maximum amount of threads checking paths concurrently.
+    /// File systems with high latency, e.g. network mounts, benefit from more
+    /// threads than there are cores.
+    ///
+    /// \param[in] count The maximum amount of threads.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setMaxThreadCount(int count);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Adds a check whether \p path exists and is of the given \p type. The
+    /// file system is not queried before QArgumentFileCache::resolve.
+    ///
+    /// \param[in] path The path to check.
+    /// \param[in] type Either QArgumentValidatorOption::File or ::Directory.
+    /// \param[in] error Locates the argument in case the check fails.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void addCheck(
+        const QString& path,
+        QArgumentValidatorOption::ArgumentType type,
+        const QArgumentError& error = QArgumentError());
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Queries every distinct path that was added since the last call, using
+    /// up to QArgumentFileCache::maxThreadCount threads, and verifies the new
+    /// checks in the order they were added.
+    ///
+    /// \return The index of the first failing check, or -1 if all succeeded.
+    ///
+    /// \remarks Calling it again continues with the checks behind the failing
+    ///          one, so that every failure can be found.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int resolve();
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Removes all checks and cached information.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void clear();
+
+private:
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        QString   path;
+        QFileInfo info;
+        bool      exists;
+        bool      isDir;
+    };
+
+    struct Check
+    {
+        int                                    entry;
+        QArgumentValidatorOption::ArgumentType type;
+        QArgumentError                         error;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    static void query(Entry*);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    QVector<Entry>      m_entries;
+    QHash<QString, int> m_entryIndices;
+    QVector<Check>      m_checks;
+    int                 m_resolvedEntries;
+    int                 m_resolvedChecks;
+    int                 m_maxThreadCount;
+};
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentFileCache
+///
+/// QArgumentParser collects the File and Directory arguments of a parse in a
+/// QArgumentFileCache instead of querying the file system once per argument.
+/// Identical paths are queried only once, and large batches are spread over a
+/// bounded amount of threads, which pays off on network file systems.
+///
+/// Failing checks are reported in the order they were added, i.e. in argument
+/// order, regardless of which thread noticed them first. The gathered file
+/// information is kept for QArgumentOption::argument<QFileInfo>.
+///
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTLIST_HPP
+#define QARGUMENTPARSER_QARGUMENTLIST_HPP
+
+#include <QArgumentParser/Config.hpp>
+
+#include <QByteArray>
+#include <QVector>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentList
+/// \brief Views the elements of a list argument in their packed storage.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+template<typename T>
+class QArgumentList
+{
+public:
+
+    typedef const T* const_iterator;
+
+    QArgumentList() = default;
+    QArgumentList(const QArgumentList& other) = default;
+    QArgumentList& operator=(const QArgumentList& other) = default;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Initializes a new list viewing the packed \p elements. The storage is
+    /// implicitly shared, not copied.
+    ///
+    /// \param[in] elements The elements, stored contiguously.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    explicit QArgumentList(const QByteArray& elements);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the amount of elements.
+    ///
+    /// \return The amount of elements.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int size() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether the list has no elements.
+    ///
+    /// \return True if empty, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isEmpty() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the first element of the contiguous storage.
+    ///
+    /// \return The elements, or null if empty.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const T* data() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the element at the given \p index.
+    ///
+    /// \param[in] index The index of the element, which must be in range.
+    /// \return The element at \p index.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const T& at(int index) const;
+    const T& operator[](int index) const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Copies the elements into a QVector, using a single memory copy.
+    ///
+    /// \return The elements.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QVector<T> toVector() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    QByteArray m_elements;
+};
+
+// Inline accessors
+#include "QArgumentList.inl"
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentList
+///
+/// List arguments (QArgumentValidatorOption::Int32List and friends) store all
+/// their elements in one contiguous buffer, which QArgumentList views without
+/// copying. Iterating a list of numbers does not convert anything again:
+///
+/// \code
+/// for (qint32 id : option.argument<QArgumentList<qint32>>("ids"))
+/// {
+///     // [use id]
+/// }
+/// \endcode
+///
+/// The view shares the buffer with the option; it stays valid on its own.
+///
+////////////////////////////////////////////////////////////////////////////////
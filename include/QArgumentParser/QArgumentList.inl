@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QARGUMENTPARSER_QARGUMENTLIST_INL
+#define QARGUMENTPARSER_QARGUMENTLIST_INL
+
+#include <cstring>
+
+template<typename T> inline QArgumentList<T>::QArgumentList(const QByteArray& elements)
+    : m_elements(elements)
+{
+}
+
+template<typename T> inline int QArgumentList<T>::size() const
+{
+    return m_elements.size() / static_cast<int>(sizeof(T));
+}
+
+template<typename T> inline bool QArgumentList<T>::isEmpty() const
+{
+    return m_elements.isEmpty();
+}
+
+template<typename T> inline const T* QArgumentList<T>::data() const
+{
+    return m_elements.isEmpty() ? nullptr : reinterpret_cast<const T*>(m_elements.constData());
+}
+
+template<typename T> inline const T& QArgumentList<T>::at(int index) const
+{
+    return data()[index];
+}
+
+template<typename T> inline const T& QArgumentList<T>::operator[](int index) const
+{
+    return data()[index];
+}
+
+template<typename T> inline typename QArgumentList<T>::const_iterator QArgumentList<T>::begin() const
+{
+    return data();
+}
+
+template<typename T> inline typename QArgumentList<T>::const_iterator QArgumentList<T>::end() const
+{
+    return data() + size();
+}
+
+template<typename T> inline QVector<T> QArgumentList<T>::toVector() const
+{
+    QVector<T> vector(size());
+    if (!vector.isEmpty())
+    {
+        std::memcpy(vector.data(), data(), m_elements.size());
+    }
+
+    return vector;
+}
+
+#endif
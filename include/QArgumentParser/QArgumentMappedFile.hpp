@@ -0,0 +1,131 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTMAPPEDFILE_HPP
+#define QARGUMENTPARSER_QARGUMENTMAPPEDFILE_HPP
+
+#include <QArgumentParser/Config.hpp>
+
+#include <QByteArray>
+#include <QFile>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentMappedFile
+/// \brief Maps a file given as argument into memory, read-only.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+class QARGUMENTPARSER_API QArgumentMappedFile
+{
+public:
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Opens and maps the file at \p path. Check QArgumentMappedFile::isMapped
+    /// to find out whether that succeeded.
+    ///
+    /// \param[in] path The path of the file.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    explicit QArgumentMappedFile(const QString& path);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the path of the file.
+    ///
+    /// \return The path of the file.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QString fileName() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether the file could be opened and mapped. Empty files
+    /// count as mapped, but have no data.
+    ///
+    /// \return True if mapped, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isMapped() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the mapped contents of the file.
+    ///
+    /// \return The first byte of the file, or null if empty or not mapped.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const char* data() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the size of the mapped contents.
+    ///
+    /// \return The amount of bytes.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    qint64 size() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Views the mapped contents as QByteArray, without copying them.
+    ///
+    /// \return The contents, or a null QByteArray if they do not fit into one.
+    ///         MappedFile arguments are rejected with
+    ///         QArgumentError::FileTooLarge in that case.
+    ///
+    /// \remarks The QByteArray does not keep the mapping alive; it must not be
+    ///          used after the last reference to this instance is gone.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QByteArray bytes() const;
+
+private:
+
+    Q_DISABLE_COPY(QArgumentMappedFile)
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    QFile       m_file;
+    const char* m_data;
+    qint64      m_size;
+    bool        m_isMapped;
+};
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentMappedFile
+///
+/// Arguments of type QArgumentValidatorOption::MappedFile are mapped exactly
+/// once, while being validated. The mapping is shared by every copy of the
+/// owning QArgumentOption and released together with the last of them, so
+/// arbitrarily large inputs are never copied into user space.
+///
+/// \code
+/// auto file = option.argument<QSharedPointer<const QArgumentMappedFile>>("in");
+/// process(file->data(), file->size());
+/// \endcode
+///
+/// With QArgumentParser::setParseThreadCount or validateBatch, files are
+/// mapped on the validating threads and released on whichever thread drops
+/// the last option. The underlying QFile is detached from any thread right
+/// away and never processes events, so this is safe.
+///
+////////////////////////////////////////////////////////////////////////////////
@@ -24,11 +24,13 @@
 #ifndef QARGUMENTPARSER_QARGUMENTOPTION_HPP
 #define QARGUMENTPARSER_QARGUMENTOPTION_HPP
 
-#include <QArgumentParser/Config.hpp>
+#include <QArgumentParser/QArgumentList.hpp>
+#include <QArgumentParser/QArgumentStorage.hpp>
 
 #include <QDir>
 #include <QFile>
-#include <QMap>
+#include <QSharedPointer>
+#include <QStringList>
 #include <QVector>
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -42,8 +44,7 @@ class QARGUMENTPARSER_API QArgumentOption
 {
 public:
 
-    QArgumentOption() = default;
-   ~QArgumentOption();
+    QArgumentOption();
     QArgumentOption(const QArgumentOption& other) = default;
     QArgumentOption& operator=(const QArgumentOption& other) = default;
 
@@ -58,17 +59,26 @@ public:
     ////////////////////////////////////////////////////////////////////////////
     /// Retrieves the argument at the given \p index, with the specified type.
     /// Supported types as of today: char, uchar, short, ushort, int, uint,
-    /// qint64, quint64, QString, QFile, QDir.
+    /// qint64, quint64, QString, QFile, QDir, QFileInfo, QByteArray and
+    /// QSharedPointer<const QArgumentMappedFile>. List arguments are returned
+    /// as QArgumentList or QVector of qint32, quint64 or QArgumentToken, and
+    /// as QStringList.
     ///
     /// It is recommended to use the QArgumentValidator in order to ensure that
-    /// the argument is converted successfully.
+    /// the argument is converted successfully. Numeric arguments validated by
+    /// a QArgumentValidator are converted once during parsing; requesting a
+    /// numeric type for a non-numeric argument yields zero.
     ///
     /// \param[in] index Index of the argument.
     /// \return An instance of the specified template type.
     ///
     /// \remarks Passing QFile as template argument will return a valid file
     ///          handle to the user-specified file. One still needs to open it
-    ///          with the desired OpenMode, though.
+    ///          with the desired OpenMode, though. Repeated calls return the
+    ///          same handle. Options that were not filled in by a parse, and
+    ///          invalid indices, yield nullptr instead. For MappedFile
+    ///          arguments, QByteArray views the mapped contents without
+    ///          copying them.
     ///
     ////////////////////////////////////////////////////////////////////////////
     template<typename T> T argument(int index) const;
@@ -76,17 +86,26 @@ public:
     ////////////////////////////////////////////////////////////////////////////
     /// Retrieves the named argument called \p name with the specified type.
     /// Supported types as of today: char, uchar, short, ushort int, uint,
-    /// qint64, quint64, QString, QFile, QDir.
+    /// qint64, quint64, QString, QFile, QDir, QFileInfo, QByteArray and
+    /// QSharedPointer<const QArgumentMappedFile>. List arguments are returned
+    /// as QArgumentList or QVector of qint32, quint64 or QArgumentToken, and
+    /// as QStringList.
     ///
     /// It is required to use a QArgumentValidator in order to have named
-    /// arguments.
+    /// arguments. The numeric value is taken from the conversion done during
+    /// validation; requesting a numeric type for a non-numeric argument
+    /// yields zero.
     ///
     /// \param name[in] The name of the argument from a QArgumentValidatorOption.
     /// \return An instance of the specified template type.
     ///
     /// \remarks Passing QFile as template argument will return a valid file
     ///          handle to the user-specified file. One still needs to open it
-    ///          with the desired OpenMode, though.
+    ///          with the desired OpenMode, though. Repeated calls return the
+    ///          same handle. Options that were not filled in by a parse, and
+    ///          invalid indices, yield nullptr instead. For MappedFile
+    ///          arguments, QByteArray views the mapped contents without
+    ///          copying them.
     ///
     ////////////////////////////////////////////////////////////////////////////
     template<typename T> T argument(const QString& name) const;
@@ -97,16 +116,22 @@ private:
     // Functions
     ////////////////////////////////////////////////////////////////////////////
     void setOption(const QString&);
-    void addArgument(const QString&, const QString&);
+    void setSchema(const QArgumentValidatorOption&);
+    void setArguments(const QArgumentStorage*, int, int);
+    const QArgumentValue& valueOf(int) const;
+    QFile* fileHandle(int) const;
 
     ////////////////////////////////////////////////////////////////////////////
     // Members
     ////////////////////////////////////////////////////////////////////////////
-    QString                 m_option;
-    QMap<QString, QString>  m_arguments;
-    mutable QVector<QFile*> m_fileHandles;
+    QString                                              m_option;
+    QArgumentValidatorOption                             m_schema;
+    QExplicitlySharedDataPointer<const QArgumentStorage> m_storage;
+    int                                                  m_argumentOffset;
+    int                                                  m_argumentCount;
 
     friend class QArgumentParser;
+    friend class QArgumentOptionView;
 };
 
 // Template specializations
@@ -136,6 +161,25 @@ private:
 /// }
 /// \endcode
 ///
+/// File and Directory arguments retrieved as QFileInfo reuse the information
+/// gathered while validating them, without querying the file system again;
+/// QDir is built from the same cached entry.
+/// MappedFile arguments are mapped once during validation; QByteArray (and,
+/// with Qt 6, QByteArrayView) view the mapping, which all copies of the option
+/// share, so large inputs are not read into memory:
+///
+/// \code
+/// QByteArray contents = option.argument<QByteArray>("input");
+/// \endcode
+///
+/// List arguments take a variable amount of arguments and keep their elements
+/// in one contiguous buffer. QArgumentList views it, QVector copies it once:
+///
+/// \code
+/// QArgumentList<qint32> ids = option.argument<QArgumentList<qint32>>("ids");
+/// QVector<quint64> sizes = option.argument<QVector<quint64>>("sizes");
+/// \endcode
+///
 /// Note: Since QFile does unfortunately not support copy construction, it must
 /// be retrieved as a pointer. You do not need to delete it, though, because the
 /// QArgumentOption class handles it.
@@ -23,71 +23,171 @@
 #ifndef QARGUMENTPARSER_QARGUMENTOPTION_INL
 #define QARGUMENTPARSER_QARGUMENTOPTION_INL
 
-template<typename T> inline T QArgumentOption::argument(int index) const
+template<typename T> inline T QArgumentOption::argument(const QString& name) const
 {
-    if (index < 0 || index >= m_arguments.size())
+    return argument<T>(m_schema.argumentIndex(name));
+}
+
+template<> inline char QArgumentOption::argument(int index) const
+{
+    const QArgumentValue& value = valueOf(index);
+    if (value.isTyped())
     {
-        return T();
+        return value.toIntegral<char>();
     }
 
-    return argument<T>(m_arguments.keys().at(index));
+    return value.token().isEmpty() ? char() : value.text().at(0).toLatin1();
+}
+
+template<> inline uchar QArgumentOption::argument(int index) const
+{
+    const QArgumentValue& value = valueOf(index);
+    return value.isTyped()
+        ? value.toIntegral<uchar>()
+        : static_cast<uchar>(value.token().toUInt());
+}
+
+template<> inline short QArgumentOption::argument(int index) const
+{
+    const QArgumentValue& value = valueOf(index);
+    return value.isTyped() ? value.toIntegral<short>() : value.token().toShort();
+}
+
+template<> inline ushort QArgumentOption::argument(int index) const
+{
+    const QArgumentValue& value = valueOf(index);
+    return value.isTyped() ? value.toIntegral<ushort>() : value.token().toUShort();
 }
 
-template<> inline char QArgumentOption::argument(const QString& name) const
+template<> inline int QArgumentOption::argument(int index) const
 {
-    return m_arguments[name].at(0).toLatin1();
+    const QArgumentValue& value = valueOf(index);
+    return value.isTyped() ? value.toIntegral<int>() : value.token().toInt();
 }
 
-template<> inline uchar QArgumentOption::argument(const QString& name) const
+template<> inline uint QArgumentOption::argument(int index) const
 {
-    return static_cast<uchar>(m_arguments[name].toUInt());
+    const QArgumentValue& value = valueOf(index);
+    return value.isTyped() ? value.toIntegral<uint>() : value.token().toUInt();
 }
 
-template<> inline short QArgumentOption::argument(const QString& name) const
+template<> inline qint64 QArgumentOption::argument(int index) const
 {
-    return m_arguments[name].toShort();
+    const QArgumentValue& value = valueOf(index);
+    return value.isTyped() ? value.toIntegral<qint64>() : value.token().toLongLong();
 }
 
-template<> inline ushort QArgumentOption::argument(const QString& name) const
+template<> inline quint64 QArgumentOption::argument(int index) const
 {
-    return m_arguments[name].toUShort();
+    const QArgumentValue& value = valueOf(index);
+    return value.isTyped() ? value.toIntegral<quint64>() : value.token().toULongLong();
 }
 
-template<> inline int QArgumentOption::argument(const QString& name) const
+template<> inline QString QArgumentOption::argument(int index) const
 {
-    return m_arguments[name].toInt();
+    return valueOf(index).text();
 }
 
-template<> inline uint QArgumentOption::argument(const QString& name) const
+template<> inline QFile* QArgumentOption::argument(int index) const
 {
-    return m_arguments[name].toUInt();
+    return fileHandle(index);
 }
 
-template<> inline qint64 QArgumentOption::argument(const QString& name) const
+template<> inline QFileInfo QArgumentOption::argument(int index) const
 {
-    return m_arguments[name].toLongLong();
+    auto path = valueOf(index).text();
+    return m_storage.data() == nullptr ? QFileInfo(path) : m_storage->files().info(path);
 }
 
-template<> inline quint64 QArgumentOption::argument(const QString& name) const
+template<> inline QDir QArgumentOption::argument(int index) const
 {
-    return m_arguments[name].toULongLong();
+    // QDir can not adopt the cached information, only its path.
+    return QDir(argument<QFileInfo>(index).filePath());
 }
 
-template<> inline QString QArgumentOption::argument(const QString& name) const
+template<> inline QSharedPointer<const QArgumentMappedFile> QArgumentOption::argument(int index) const
 {
-    return m_arguments.value(name);
+    const QArgumentValue& value = valueOf(index);
+    if (!value.mappedFile().isNull() || value.isTyped())
+    {
+        return value.mappedFile();
+    }
+
+    // Without a validator, the file is mapped on request.
+    return QSharedPointer<const QArgumentMappedFile>(new QArgumentMappedFile(value.text()));
 }
 
-template<> inline QFile* QArgumentOption::argument(const QString& name) const
+template<> inline QByteArray QArgumentOption::argument(int index) const
 {
-    m_fileHandles.append(new QFile(m_arguments[name]));
+    const QArgumentValue& value = valueOf(index);
+    return value.mappedFile().isNull() ? QByteArray() : value.mappedFile()->bytes();
+}
 
-    return m_fileHandles.last();
+template<> inline QArgumentList<qint32> QArgumentOption::argument(int index) const
+{
+    const QArgumentValue& value = valueOf(index);
+    return value.type() == QArgumentValidatorOption::Int32List
+        ? QArgumentList<qint32>(value.listElements())
+        : QArgumentList<qint32>();
 }
 
-template<> inline QDir QArgumentOption::argument(const QString& name) const
+template<> inline QArgumentList<quint64> QArgumentOption::argument(int index) const
 {
-    return QDir(m_arguments[name]);
+    const QArgumentValue& value = valueOf(index);
+    return value.type() == QArgumentValidatorOption::UInt64List
+        ? QArgumentList<quint64>(value.listElements())
+        : QArgumentList<quint64>();
 }
 
+template<> inline QArgumentList<QArgumentToken> QArgumentOption::argument(int index) const
+{
+    const QArgumentValue& value = valueOf(index);
+    return value.type() == QArgumentValidatorOption::StringList ||
+           value.type() == QArgumentValidatorOption::FileList
+        ? QArgumentList<QArgumentToken>(value.listElements())
+        : QArgumentList<QArgumentToken>();
+}
+
+template<> inline QVector<qint32> QArgumentOption::argument(int index) const
+{
+    return argument<QArgumentList<qint32>>(index).toVector();
+}
+
+template<> inline QVector<quint64> QArgumentOption::argument(int index) const
+{
+    return argument<QArgumentList<quint64>>(index).toVector();
+}
+
+template<> inline QVector<QArgumentToken> QArgumentOption::argument(int index) const
+{
+    return argument<QArgumentList<QArgumentToken>>(index).toVector();
+}
+
+template<> inline QStringList QArgumentOption::argument(int index) const
+{
+    auto tokens = argument<QArgumentList<QArgumentToken>>(index);
+
+    QStringList strings;
+    strings.reserve(tokens.size());
+    for (const auto& token : tokens)
+    {
+        strings.append(token.toString());
+    }
+
+    return strings;
+}
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+template<> inline QByteArrayView QArgumentOption::argument(int index) const
+{
+    const QArgumentValue& value = valueOf(index);
+    if (value.mappedFile().isNull())
+    {
+        return QByteArrayView();
+    }
+
+    return QByteArrayView(value.mappedFile()->data(), value.mappedFile()->size());
+}
+#endif
+
 #endif
@@ -0,0 +1,224 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTOPTIONVIEW_HPP
+#define QARGUMENTPARSER_QARGUMENTOPTIONVIEW_HPP
+
+#include <QArgumentParser/QArgumentOption.hpp>
+
+#include <iterator>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentOptionView
+/// \brief Refers to a parsed option without copying it.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+class QARGUMENTPARSER_API QArgumentOptionView
+{
+public:
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Iterates over the options of a parser and yields a view of each one.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    class Iterator
+    {
+    public:
+
+        typedef std::forward_iterator_tag iterator_category;
+        typedef QArgumentOptionView       value_type;
+        typedef std::ptrdiff_t            difference_type;
+        typedef void                      pointer;
+        typedef QArgumentOptionView       reference;
+
+        explicit Iterator(const QArgumentOption* option = nullptr);
+
+        QArgumentOptionView operator*() const;
+        Iterator& operator++();
+        Iterator operator++(int);
+        bool operator==(const Iterator& other) const;
+        bool operator!=(const Iterator& other) const;
+
+    private:
+
+        const QArgumentOption* m_option;
+    };
+
+    QArgumentOptionView();
+    QArgumentOptionView(const QArgumentOptionView& other) = default;
+    QArgumentOptionView& operator=(const QArgumentOptionView& other) = default;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Initializes a new view of \p option. The option is not copied and must
+    /// outlive the view.
+    ///
+    /// \param[in] option The option to view.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    explicit QArgumentOptionView(const QArgumentOption& option);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether this view refers to a parsed option.
+    ///
+    /// \return True if the option was parsed, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isValid() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the option as string. See QArgumentOption::option.
+    ///
+    /// \return The option.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QString& option() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the declaration of the option. Without a QArgumentValidator,
+    /// it declares no arguments.
+    ///
+    /// \return The declaration of the option.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentValidatorOption& schema() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the amount of arguments of the option. With a validator, a
+    /// list argument counts once.
+    ///
+    /// \return The amount of arguments.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int argumentCount() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the name of the argument at \p index, if it was declared by
+    /// a QArgumentValidatorOption.
+    ///
+    /// \param[in] index Index of the argument.
+    /// \return The name of the argument, or a null string.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QString& argumentName(int index) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the argument at \p index as it is kept by the parser: its
+    /// token and, if validated, its converted value.
+    ///
+    /// \param[in] index Index of the argument.
+    /// \return The argument, or an empty one if \p index is out of range.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentValue& value(int index) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the named argument called \p name as it is kept by the parser.
+    ///
+    /// \param[in] name The name of the argument from a QArgumentValidatorOption.
+    /// \return The argument, or an empty one if there is no such argument.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentValue& value(const QString& name) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the argument at \p index with the specified type. See
+    /// QArgumentOption::argument for the supported types.
+    ///
+    /// \param[in] index Index of the argument.
+    /// \return An instance of the specified template type.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename T> T argument(int index) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the named argument called \p name with the specified type.
+    /// See QArgumentOption::argument for the supported types.
+    ///
+    /// \param[in] name The name of the argument from a QArgumentValidatorOption.
+    /// \return An instance of the specified template type.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename T> T argument(const QString& name) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the first argument of the option, for range-based for loops.
+    ///
+    /// \return Pointer to the first argument.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentValue* begin() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the end of the arguments of the option.
+    ///
+    /// \return Pointer past the last argument.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentValue* end() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the viewed option, e.g. to keep a copy of it.
+    ///
+    /// \return The option.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentOption& toOption() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentOption* m_option;
+};
+
+// Inline functions and template specializations
+#include "QArgumentOptionView.inl"
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentOptionView
+///
+/// A view is a single pointer to an option kept by the QArgumentParser. Unlike
+/// QArgumentParser::option, which returns a copy, obtaining and passing views
+/// around does not touch any reference count; reading the option name and the
+/// tokens and converted values of its arguments does not allocate memory:
+///
+/// \code
+/// for (QArgumentOptionView option : parser)
+/// {
+///     for (const QArgumentValue& value : option)
+///     {
+///         // [log option.option() and value.token()]
+///     }
+/// }
+/// \endcode
+///
+/// Views are valid until the next parse or QArgumentParser::reset. To keep an
+/// option beyond that, copy it with QArgumentOptionView::toOption.
+///
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef QARGUMENTPARSER_QARGUMENTOPTIONVIEW_INL
+#define QARGUMENTPARSER_QARGUMENTOPTIONVIEW_INL
+
+inline QArgumentOptionView::Iterator::Iterator(const QArgumentOption* option)
+    : m_option(option)
+{
+}
+
+inline QArgumentOptionView QArgumentOptionView::Iterator::operator*() const
+{
+    return QArgumentOptionView(*m_option);
+}
+
+inline QArgumentOptionView::Iterator& QArgumentOptionView::Iterator::operator++()
+{
+    m_option++;
+    return *this;
+}
+
+inline QArgumentOptionView::Iterator QArgumentOptionView::Iterator::operator++(int)
+{
+    Iterator previous = *this;
+    m_option++;
+
+    return previous;
+}
+
+inline bool QArgumentOptionView::Iterator::operator==(const Iterator& other) const
+{
+    return m_option == other.m_option;
+}
+
+inline bool QArgumentOptionView::Iterator::operator!=(const Iterator& other) const
+{
+    return m_option != other.m_option;
+}
+
+inline QArgumentOptionView::QArgumentOptionView(const QArgumentOption& option)
+    : m_option(&option)
+{
+}
+
+inline bool QArgumentOptionView::isValid() const
+{
+    return !m_option->m_option.isNull();
+}
+
+inline const QString& QArgumentOptionView::option() const
+{
+    return m_option->m_option;
+}
+
+inline const QArgumentValidatorOption& QArgumentOptionView::schema() const
+{
+    return m_option->m_schema;
+}
+
+inline int QArgumentOptionView::argumentCount() const
+{
+    return m_option->m_argumentCount;
+}
+
+inline const QString& QArgumentOptionView::argumentName(int index) const
+{
+    return m_option->m_schema.argumentName(index);
+}
+
+inline const QArgumentValue& QArgumentOptionView::value(int index) const
+{
+    return m_option->valueOf(index);
+}
+
+inline const QArgumentValue& QArgumentOptionView::value(const QString& name) const
+{
+    return m_option->valueOf(m_option->m_schema.argumentIndex(name));
+}
+
+template<typename T> inline T QArgumentOptionView::argument(int index) const
+{
+    return m_option->argument<T>(index);
+}
+
+template<typename T> inline T QArgumentOptionView::argument(const QString& name) const
+{
+    return m_option->argument<T>(name);
+}
+
+inline const QArgumentValue* QArgumentOptionView::begin() const
+{
+    // The arguments of an option are adjacent in the storage of the parse.
+    return m_option->m_argumentCount > 0 ? &m_option->valueOf(0) : nullptr;
+}
+
+inline const QArgumentValue* QArgumentOptionView::end() const
+{
+    return begin() + m_option->m_argumentCount;
+}
+
+inline const QArgumentOption& QArgumentOptionView::toOption() const
+{
+    return *m_option;
+}
+
+#endif
@@ -24,9 +24,21 @@
 #ifndef QARGUMENTPARSER_QARGUMENTPARSER_HPP
 #define QARGUMENTPARSER_QARGUMENTPARSER_HPP
 
+#include <QArgumentParser/QArgumentBinding.hpp>
+#include <QArgumentParser/QArgumentConfigFile.hpp>
 #include <QArgumentParser/QArgumentOption.hpp>
+#include <QArgumentParser/QArgumentOptionView.hpp>
+#include <QArgumentParser/QArgumentSnapshot.hpp>
+#include <QArgumentParser/QArgumentStatistics.hpp>
+#include <QArgumentParser/QArgumentTokenizer.hpp>
 #include <QArgumentParser/QArgumentValidator.hpp>
 
+#include <QSharedPointer>
+#include <functional>
+#include <memory>
+
+class QIODevice;
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \class QArgumentParser
 /// \brief Parses arguments from the command line.
@@ -42,7 +54,8 @@ public:
     {
         Success,
         Failure,
-        HelpRequested
+        HelpRequested,
+        CompletionRequested
     };
 
     QArgumentParser(const QArgumentParser& other);
@@ -57,7 +70,8 @@ public:
     /// \param[in] argv The arguments themselves.
     ///
     /// \remarks The first argument will not be parsed, but can be retrieved via
-    ///          QArgumentParser::firstArgument.
+    ///          QArgumentParser::firstArgument. The other arguments are not
+    ///          copied; \p argv must outlive the parser and its results.
     ///
     ////////////////////////////////////////////////////////////////////////////
     QArgumentParser(int argc, char* argv[]);
@@ -85,13 +99,84 @@ public:
     const QArgumentOption option(const QString& name) const;
 
     ////////////////////////////////////////////////////////////////////////////
-    /// Retrieves the validator of this parser.
+    /// Retrieves a view of the option with the given \p name. Unlike
+    /// QArgumentParser::option, the option is not copied.
+    ///
+    /// \param[in] name The option to retrieve.
+    /// \return A view of the option; invalid if it was not parsed.
+    ///
+    /// \remarks The view is valid until the next parse or reset.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentOptionView optionView(const QString& name) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the amount of options kept by the last parse. Streamed and
+    /// bound options are not kept.
+    ///
+    /// \return The amount of parsed options.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int optionCount() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the first parsed option, for range-based for loops. Options
+    /// are visited in the order they were given in; an option given several
+    /// times is visited once, at the position it was first given at.
+    ///
+    /// \return Iterator to the first option.
+    ///
+    /// \remarks Iterators are valid until the next parse or reset.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentOptionView::Iterator begin() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the end of the parsed options.
+    ///
+    /// \return Iterator past the last option.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentOptionView::Iterator end() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Copies the options of the last parse, along with the text of all their
+    /// arguments, into an immutable QArgumentSnapshot that does not depend on
+    /// this parser anymore.
+    ///
+    /// \return The snapshot.
+    ///
+    /// \remarks Must not be called while this parser parses. The snapshot
+    ///          itself may be shared with and read by any thread.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    std::shared_ptr<const QArgumentSnapshot> snapshot() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the validator of this parser. After parsing the arguments of
+    /// a subcommand, this is the validator of the subcommand.
     ///
     /// \return The validator.
     ///
     ////////////////////////////////////////////////////////////////////////////
     const QArgumentValidator& validator() const;
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the name of the subcommand chosen by the last parse.
+    ///
+    /// \return The subcommand, or a null string if none was given.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QString& subcommand() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the amount of subcommands added to this parser.
+    ///
+    /// \return The amount of subcommands.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int subcommandCount() const;
+
     ////////////////////////////////////////////////////////////////////////////
     /// Retrieves the option indicator. By default, this is a dash ('-').
     ///
@@ -100,23 +185,205 @@ public:
     ////////////////////////////////////////////////////////////////////////////
     const QString& optionIndicator() const;
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the help option, without the option indicator. By default,
+    /// this is 'h'.
+    ///
+    /// \return The help option.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QString& helpOption() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the first error along with result QArgumentParser::Failure.
+    ///
+    /// \return The error, QArgumentError::NoError if there is none.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentError& error() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves all errors along with result QArgumentParser::Failure. Unless
+    /// error collection is enabled, there is at most one.
+    ///
+    /// \return The errors, in the order of the input.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QVector<QArgumentError>& errors() const;
+
     ////////////////////////////////////////////////////////////////////////////
     /// Retrieves the error message along with result QArgumentParser::Failure.
+    /// The message is formatted by the first call after the failure; several
+    /// errors yield one line each.
     ///
     /// \return The error message.
     ///
     ////////////////////////////////////////////////////////////////////////////
     const QString& errorMessage() const;
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether parsing goes on after an invalid option in order to
+    /// report every error at once. This property is 'false' by default.
+    ///
+    /// \return True if errors are collected, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isErrorCollectionEnabled() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether options may be abbreviated, e.g. "-am" for "-amount".
+    /// This property is 'false' by default.
+    ///
+    /// \return True if abbreviations are resolved, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isAbbreviationEnabled() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether a first argument of "--complete" requests shell
+    /// completion. This property is 'false' by default.
+    ///
+    /// \return True if completion can be requested, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isCompletionEnabled() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the candidates found by the last parse that returned
+    /// QArgumentParser::CompletionRequested.
+    ///
+    /// \return The candidates for the last word, ordered by name.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QStringList& completions() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether '\@path' arguments are expanded to the contents of
+    /// the response file at 'path'. This property is 'false' by default.
+    ///
+    /// \return True if response files are enabled, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isResponseFileEnabled() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves how response files are split into arguments. By default, this
+    /// is QArgumentTokenizer::Whitespace.
+    ///
+    /// \return The tokenizer mode for response files.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentTokenizer::Mode responseFileMode() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the maximum amount of threads checking File and Directory
+    /// arguments. By default, this is QThread::idealThreadCount.
+    ///
+    /// \return The maximum amount of threads.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int pathCheckThreadCount() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the maximum amount of threads validating options. By default,
+    /// this is 1: every option is validated as soon as it is complete.
+    ///
+    /// \return The maximum amount of threads.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int parseThreadCount() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the maximum amount of threads of QArgumentParser::validateBatch.
+    /// By default, this is QThread::idealThreadCount.
+    ///
+    /// \return The maximum amount of threads.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int batchThreadCount() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether unescaped arguments are interned into an arena.
+    /// This property is 'false' by default.
+    ///
+    /// \return True if the arena is enabled, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isArenaEnabled() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the size of the blocks allocated by the arena. By default,
+    /// this is QArgumentArena::defaultBlockSize.
+    ///
+    /// \return The block size, in bytes.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int arenaBlockSize() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether statistics are collected while parsing. This is
+    /// 'false' by default, unless QARGUMENTPARSER_STATISTICS is set.
+    ///
+    /// \return True if statistics are collected, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isStatisticsEnabled() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the statistics of the last parse.
+    ///
+    /// \return The statistics; all zero if they were not enabled.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentStatistics& statistics() const;
+
     ////////////////////////////////////////////////////////////////////////////
     /// Specifies a new validator for the options and their arguments. In order
-    /// to guarantee type safety and validity, one must use a validator.
+    /// to guarantee type safety and validity, one must use a validator. The
+    /// copy kept by the parser is compiled (see QArgumentValidator::compile).
     ///
     /// \param[in] validator The new validator to use.
     ///
     ////////////////////////////////////////////////////////////////////////////
     void setValidator(const QArgumentValidator& validator);
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// Shares \p validator instead of copying it. Any amount of parsers, also
+    /// on different threads, may share one compiled validator.
+    ///
+    /// \param[in] validator The validator to share.
+    ///
+    /// \remarks A validator that is not compiled yet is copied and compiled,
+    ///          like with the other overload.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setValidator(const QSharedPointer<const QArgumentValidator>& validator);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Adds a subcommand called \p name, e.g. "commit" of "git commit". If the
+    /// first argument names a subcommand, the remaining ones are validated by
+    /// its validator instead of the one given to QArgumentParser::setValidator.
+    ///
+    /// \param[in] name The name of the subcommand.
+    /// \param[in] factory Declares the options of the subcommand on the given,
+    ///            empty validator.
+    ///
+    /// \remarks \p factory is called the first time the subcommand is chosen
+    ///          and its compiled validator is kept for subsequent parses. A
+    ///          subcommand of the same name is replaced. Factories are always
+    ///          called on the thread calling parse() or validateBatch().
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void addSubcommand(
+        const QString& name,
+        const std::function<void(QArgumentValidator*)>& factory);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Removes all subcommands added through QArgumentParser::addSubcommand.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void clearSubcommands();
+
     ////////////////////////////////////////////////////////////////////////////
     /// Specifies the option indicator. By default, this is a dash ('-'). Users
     /// developing Windows-only applications may use a slash ('/') or something
@@ -127,6 +394,198 @@ public:
     ////////////////////////////////////////////////////////////////////////////
     void setOptionIndicator(const QString& indicator);
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the option for which parsing returns
+    /// QArgumentParser::HelpRequested. By default, this is 'h', i.e. '-h'.
+    ///
+    /// \param[in] option The new help option without the option indicator,
+    ///            e.g. "help". An empty option disables the help request.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setHelpOption(const QString& option);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies whether '\@path' arguments are expanded to the contents of
+    /// the response file at 'path'. Response files are memory-mapped and their
+    /// arguments are viewed in place; they may include further response files.
+    ///
+    /// \param[in] enabled True to expand response files, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setResponseFileEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies how response files are split into arguments.
+    ///
+    /// \param[in] mode The tokenizer mode for response files.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setResponseFileMode(QArgumentTokenizer::Mode mode);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the maximum amount of threads checking File and Directory
+    /// arguments. The checks of one parse are batched and every distinct path
+    /// is queried once; network file systems benefit from more threads.
+    ///
+    /// \param[in] count The maximum amount of threads.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setPathCheckThreadCount(int count);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the maximum amount of threads validating options. With more
+    /// than one, the input is split into options at the option indicators
+    /// first; the options are then validated in blocks on a thread pool and
+    /// merged in input order. The parsed options and the reported error are
+    /// the same as with a single thread.
+    ///
+    /// \param[in] count The maximum amount of threads.
+    ///
+    /// \remarks Pays off for inputs of many thousand options, e.g. argument
+    ///          vectors near ARG_MAX or large response files. Smaller inputs
+    ///          are still validated on the calling thread.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setParseThreadCount(int count);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the maximum amount of threads of QArgumentParser::validateBatch.
+    ///
+    /// \param[in] count The maximum amount of threads.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setBatchThreadCount(int count);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies whether arguments that can not be viewed in place, i.e. those
+    /// of response files and command lines with quotes or escapes removed,
+    /// are interned into an arena rather than allocated one by one. Identical
+    /// arguments are stored once, and all of them are freed at once along with
+    /// the results of the parse.
+    ///
+    /// \param[in] enabled True to use the arena, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setArenaEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies whether parsing goes on after an invalid option. If enabled,
+    /// the whole input is validated in one pass: every invalid argument, every
+    /// missing path and every missing required option is reported through
+    /// QArgumentParser::errors. Invalid options are not kept.
+    ///
+    /// \param[in] enabled True to collect all errors, false to stop at the
+    ///                    first one.
+    ///
+    /// \remarks Unreadable input, e.g. an unterminated quote, still ends the
+    ///          parse. Streamed input always stops at the first error.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setErrorCollectionEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies whether options may be abbreviated. If enabled, an option that
+    /// is not declared is resolved to the only declared option starting with
+    /// it; ambiguous abbreviations are invalid options.
+    ///
+    /// \param[in] enabled True to resolve abbreviations, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setAbbreviationEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies whether a first argument of "--complete" requests shell
+    /// completion. The following arguments are the words typed so far, the
+    /// last of which is completed; parse() then returns
+    /// QArgumentParser::CompletionRequested without validating anything and
+    /// QArgumentParser::completions holds the candidates.
+    ///
+    /// \param[in] enabled True to allow completion requests, false otherwise.
+    ///
+    /// \remarks Options are completed after the option indicator, subcommands
+    ///          as the first word and arguments of type File, Directory,
+    ///          MappedFile and FileList from the file system.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setCompletionEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the size of the blocks allocated by the arena. Larger blocks
+    /// mean fewer allocations for large inputs, but more unused memory for
+    /// small ones. Takes effect with the next parse.
+    ///
+    /// \param[in] size The block size, in bytes.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setArenaBlockSize(int size);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies whether timings and counters are collected while parsing.
+    /// See QArgumentStatistics for what is measured.
+    ///
+    /// \param[in] enabled True to collect statistics, false otherwise.
+    ///
+    /// \remarks Has no effect if the library was built with the macro
+    ///          QARGUMENTPARSER_NO_STATISTICS defined.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setStatisticsEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Binds the argument \p argument of the option \p option to \p member of
+    /// a user-defined structure. QArgumentParser::parse(Struct*) writes the
+    /// converted argument to that member. See QArgumentBinding for the
+    /// supported member types.
+    ///
+    /// \param[in] option The name of the option.
+    /// \param[in] argument The name of the argument.
+    /// \param[in] member The data member receiving the converted argument.
+    ///
+    /// \remarks Members of type QArgumentToken, or lists of it, are only valid
+    ///          until the next parse or the destruction of the parser.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename Struct, typename T>
+    void bind(const QString& option, const QString& argument, T Struct::* member);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Binds the presence of the option \p option to \p member of a
+    /// user-defined structure, which is set to 'true' if the option is given.
+    ///
+    /// \param[in] option The name of the option.
+    /// \param[in] member The data member receiving the presence of the option.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename Struct>
+    void bind(const QString& option, bool Struct::* member);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Removes all bindings made through QArgumentParser::bind.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void clearBindings();
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Adds \p file to the config files consulted for options that are not
+    /// given on the command line or by the environment; see
+    /// QArgumentValidatorOption::setConfigKey. Files added later take
+    /// precedence over those added earlier.
+    ///
+    /// \param[in] file The loaded config file.
+    ///
+    /// \remarks The arguments of the file are validated like command line
+    ///          arguments; the options refer to them, so the parser keeps a
+    ///          copy of \p file until QArgumentParser::clearConfigFiles.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void addConfigFile(const QArgumentConfigFile& file);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Removes all config files added through QArgumentParser::addConfigFile.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void clearConfigFiles();
+
     ////////////////////////////////////////////////////////////////////////////
     /// Attempts to parse all the options and arguments according to the rules
     /// specified by a validator set through QArgumentParser::setValidator.
@@ -140,26 +599,251 @@ public:
     ////////////////////////////////////////////////////////////////////////////
     ResultType parse();
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// Discards the results and the error message of the last parse, but keeps
+    /// the memory they occupied for the next parse. Every parse begins with a
+    /// reset on its own; calling it early releases the results sooner.
+    ///
+    /// \remarks Options retrieved before stay valid. As long as they are
+    ///          alive, though, the next parse can not reuse their storage.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void reset();
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Parses the arguments like QArgumentParser::parse and writes every bound
+    /// argument straight to \p target, in the same pass. Only bindings made
+    /// for members of \p Struct are applied.
+    ///
+    /// \param[in] target The structure receiving the bound arguments.
+    /// \return The type of the result.
+    ///
+    /// \remarks Options with at least one binding are not kept, thus
+    ///          QArgumentParser::option returns invalid options for them.
+    ///          Members of options that are not given keep their values; on
+    ///          failure, \p target may have been written partially.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename Struct> ResultType parse(Struct* target);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Parses the UTF-8 encoded, null-terminated \p arguments instead of the
+    /// ones passed to the constructor. The first entry is parsed as well.
+    ///
+    /// \param[in] arguments The arguments to parse.
+    /// \param[in] count The amount of arguments.
+    /// \return The type of the result.
+    ///
+    /// \remarks The arguments are not copied and must outlive the results.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    ResultType parse(const char* const* arguments, int count);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Parses the already decoded \p arguments instead of the ones passed to
+    /// the constructor. The first entry is parsed as well.
+    ///
+    /// \param[in] arguments The arguments to parse.
+    /// \param[in] count The amount of arguments.
+    /// \return The type of the result.
+    ///
+    /// \remarks The arguments are not copied and must outlive the results.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    ResultType parse(const QStringView* arguments, int count);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Splits \p commandLine into arguments the way a POSIX shell does and
+    /// parses them (see QArgumentTokenizer::Shell). Arguments are viewed in
+    /// the command line unless quotes or escapes have to be removed; no list
+    /// of arguments is built in between.
+    ///
+    /// \param[in] commandLine The command line to parse.
+    /// \param[in] comment The character starting a comment, or '\0'.
+    /// \return The type of the result.
+    ///
+    /// \remarks The command line is not copied and must outlive the results.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    ResultType parse(QStringView commandLine, char comment = '\0');
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Parses arguments read from \p device, e.g. stdin or a pipe, and passes
+    /// each option to \p callback as soon as the next option indicator shows
+    /// that it is complete. Every option is validated on its own, so memory
+    /// usage does not grow with the length of the input.
+    ///
+    /// \param[in] device The device to read the arguments from.
+    /// \param[in] callback The function receiving every validated option.
+    /// \param[in] mode Specifies how the input is split into arguments.
+    /// \return The type of the result.
+    ///
+    /// \remarks The option passed to \p callback is only valid during the
+    ///          call; copy the values it needs. Streamed options are not kept,
+    ///          thus QArgumentParser::option returns invalid options afterwards.
+    ///          Required options are checked at the end of the input. Streams
+    ///          are not complemented by the environment, config files or
+    ///          default arguments, and do not select subcommands.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    ResultType parse(
+        QIODevice* device,
+        const std::function<void(const QArgumentOption&)>& callback,
+        QArgumentTokenizer::Mode mode = QArgumentTokenizer::Whitespace);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Validates any amount of argument vectors, e.g. the command lines of
+    /// jobs to run, on up to QArgumentParser::batchThreadCount threads. Every
+    /// thread parses with a parser of its own that shares the validator, the
+    /// option indicator and the error collection setting of this parser; the
+    /// parser itself is not modified.
+    ///
+    /// \param[in] argumentLists The argument vectors. Every entry of a vector
+    ///            is parsed, the first one as well.
+    /// \param[out] errors Receives the errors of every vector, if not null.
+    /// \return The result of every vector, in the order of \p argumentLists.
+    ///
+    /// \remarks The vectors are validated by themselves: response files, the
+    ///          environment and config files of the calling process are not
+    ///          consulted, but default arguments are. The tokens of \p errors
+    ///          view \p argumentLists and the validator.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QVector<ResultType> validateBatch(
+        const QVector<QStringList>& argumentLists,
+        QVector<QVector<QArgumentError>>* errors = nullptr) const;
+
 private:
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////////////////////
+    struct Segment;
+
+    struct Subcommand
+    {
+        QString                                  name;
+        std::function<void(QArgumentValidator*)> factory;
+        QSharedPointer<const QArgumentValidator> validator;
+    };
+
     ////////////////////////////////////////////////////////////////////////////
     // Functions
     ////////////////////////////////////////////////////////////////////////////
-    void insertOption(const QString&, const QVector<QString>&);
-    bool isMissingRequired(QString*);
+    const QArgumentOption& findOption(const QString&) const;
+    ResultType parseArguments();
+    void selectSubcommand(int);
+    int findSubcommand(const QArgumentToken&) const;
+    const QSharedPointer<const QArgumentValidator>& buildSubcommand(int) const;
+    ResultType complete();
+    void completePaths(const QString&, bool);
+    ResultType parseBound(const void*, void*);
+    bool resolveBindings(const void*);
+    bool bindOption(int, const QVector<QArgumentValue>&);
+    ResultType parseStream(
+        QIODevice*,
+        const std::function<void(const QArgumentOption&)>&,
+        QArgumentTokenizer::Mode);
+    QArgumentToken tokenAt(int) const;
+    ResultType consumeCommandLine();
+    bool consumeSources();
+    bool readEnvironment(const QArgumentValidatorOption&);
+    bool readConfigFiles(const QArgumentValidatorOption&);
+    bool readDefaults(const QArgumentValidatorOption&);
+    bool hasSources() const;
+    void prepareTokenizer(QArgumentTokenizer*);
+    ResultType consumeArgument(const QArgumentToken&, int);
+    ResultType consumeToken(const QArgumentToken&);
+    bool isHelpOption(const QArgumentToken&) const;
+    ResultType consumeResponseFile(const QArgumentToken&, int);
+    bool commitOption(
+        const QArgumentToken&,
+        int,
+        const QVector<QArgumentToken>&,
+        QVector<QArgumentValue>*);
+    bool endOption();
+    bool commitSegments(QVector<Segment>*);
+    bool validateOption(
+        const QArgumentToken&,
+        int,
+        const QVector<QArgumentToken>&,
+        QVector<QArgumentValue>*,
+        QArgumentFileCache*,
+        int*,
+        QVector<QArgumentError>*) const;
+    QArgumentOption makeOption(
+        int,
+        const QArgumentToken&,
+        const QVector<QArgumentToken>&,
+        const QVector<QArgumentValue>&);
+    void insertOption(int, const QArgumentOption&);
+    bool streamOption(
+        const QByteArray&,
+        const QVector<int>&,
+        int,
+        const std::function<void(const QArgumentOption&)>&);
+    void prepareStorage();
+    ResultType failPaths();
+    bool validatePaths();
+    bool isMissingRequired();
+    ResultType fail(QArgumentError::Code, const QArgumentToken&, int);
+    QArgumentStatistics* collectedStatistics();
+    void finishStatistics();
 
     ////////////////////////////////////////////////////////////////////////////
     // Members
     ////////////////////////////////////////////////////////////////////////////
-    QVector<QString>               m_arguments;
-    QArgumentValidator             m_validator;
-    QArgumentOption                m_defaultOption;
-    QMap<QString, QArgumentOption> m_options;
-    QString                        m_optionIndicator;
-    QString                        m_firstArgument;
-    QString                        m_errorMessage;
+    const char* const*                             m_argumentsUtf8;
+    const QStringView*                             m_argumentsUtf16;
+    int                                            m_argumentCount;
+    QStringView                                    m_commandLine;
+    char                                           m_commentCharacter;
+    QSharedPointer<const QArgumentValidator>       m_validator;
+    QSharedPointer<const QArgumentValidator>       m_mainValidator;
+    mutable QVector<Subcommand>                    m_subcommands;
+    int                                            m_subcommand;
+    int                                            m_subcommandEnd;
+    QArgumentOption                                m_defaultOption;
+    QVector<QArgumentOption>                       m_options;
+    QVector<int>                                   m_optionSlots;
+    QArgumentToken                                 m_currentOption;
+    int                                            m_currentPosition;
+    int                                            m_tokenCount;
+    QVector<QArgumentToken>                        m_currentArgs;
+    QVector<QArgumentValue>                        m_currentValues;
+    QExplicitlySharedDataPointer<QArgumentStorage> m_storage;
+    QString                                        m_optionIndicator;
+    QString                                        m_helpOption;
+    QString                                        m_firstArgument;
+    QStringList                                    m_completions;
+    QVector<QArgumentError>                        m_errors;
+    mutable QString                                m_errorMessage;
+    QArgumentStatistics                            m_statistics;
+    QVector<QArgumentBinding>                      m_bindings;
+    QVector<QArgumentConfigFile>                   m_configFiles;
+    QVector<int>                                   m_boundBindings;
+    QVector<int>                                   m_boundArguments;
+    QVector<int>                                   m_boundOffsets;
+    void*                                          m_boundTarget;
+    QVector<Segment>*                              m_segments;
+    int                                            m_pathCheckThreadCount;
+    int                                            m_parseThreadCount;
+    int                                            m_batchThreadCount;
+    int                                            m_arenaBlockSize;
+    QArgumentTokenizer::Mode                       m_responseFileMode;
+    bool                                           m_isResponseFileEnabled;
+    bool                                           m_isArenaEnabled;
+    bool                                           m_isErrorCollectionEnabled;
+    bool                                           m_isAbbreviationEnabled;
+    bool                                           m_isCompletionEnabled;
+    bool                                           m_isEnvironmentEnabled;
+    bool                                           m_isStatisticsEnabled;
+    bool                                           m_isStatisticsPrinted;
 };
 
+// Template definitions
+#include "QArgumentParser.inl"
+
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -196,4 +880,130 @@ private:
 /// }
 /// \endcode
 ///
+/// The parser works on the arguments in place: neither argv nor the buffers
+/// passed to the parse() overloads are copied or converted to QString. Parsed
+/// options refer to that storage, so it has to outlive them.
+///
+/// Input that arrives over time is parsed as a stream; each option is handed
+/// out as soon as it is complete:
+///
+/// \code
+/// QFile input;
+/// input.open(stdin, QFile::ReadOnly);
+///
+/// parser.parse(&input, [](const QArgumentOption& option)
+/// {
+///     // [start working on the option]
+/// });
+/// \endcode
+///
+/// One parser can parse any amount of command lines, e.g. those arriving over
+/// a control socket. It keeps its buffers between parses and may share its
+/// validator with other parsers; once the buffers have grown and no option of
+/// an earlier parse is kept alive, parsing numbers and strings does not
+/// allocate any memory:
+///
+/// \code
+/// auto shared = QSharedPointer<const QArgumentValidator>(new QArgumentValidator(validator));
+/// parser.setValidator(shared);
+///
+/// for (const auto& command : commands)
+/// {
+///     parser.parse(command.arguments, command.count);
+///     // [handle the command]
+///     parser.reset();
+/// }
+/// \endcode
+///
+/// A compiled validator is never modified, so the parsers of several threads
+/// can share it. QArgumentParser::validateBatch does so in order to check many
+/// argument vectors at once:
+///
+/// \code
+/// QVector<QVector<QArgumentError>> errors;
+/// auto results = parser.validateBatch(jobs, &errors);
+///
+/// for (int i = 0; i < results.size(); i++)
+/// {
+///     if (results.at(i) == QArgumentParser::Failure)
+///         // [reject job i because of errors.at(i)]
+/// }
+/// \endcode
+///
+/// Tools bundling many commands register each of them as a subcommand. Only
+/// the validator of the chosen subcommand is ever built, so the startup cost
+/// does not grow with the amount of subcommands:
+///
+/// \code
+/// parser.addSubcommand("commit", [](QArgumentValidator* validator)
+/// {
+///     QArgumentValidatorOption message("m");
+///     message.addArgument("text", QArgumentValidatorOption::String);
+///     validator->addOption(message);
+/// });
+///
+/// if (parser.parse() == QArgumentParser::Success && parser.subcommand() == "commit")
+///     // [commit with parser.optionView("m").argument<QString>("text")]
+/// \endcode
+///
+/// With QArgumentParser::setCompletionEnabled, shells can ask the program for
+/// the candidates of the word being typed. This only looks up the sorted name
+/// table of the validator, so it is answered quickly even for many options:
+///
+/// \code
+/// // $ tool --complete -f ./sr  (for "tool -f ./sr<TAB>")
+/// if (parser.parse() == QArgumentParser::CompletionRequested)
+/// {
+///     for (const QString& candidate : parser.completions())
+///         std::puts(qPrintable(candidate));
+/// }
+/// \endcode
+///
+/// Command lines given as a single string, e.g. typed into a console, are
+/// split like a shell would split them:
+///
+/// \code
+/// QString line = QStringLiteral("-file 'my file.txt' -amount 4 # four times");
+/// auto result = parser.parse(line, '#');
+/// \endcode
+///
+/// Options not given on the command line are taken from the environment,
+/// from config files or from their default arguments, in this order; each
+/// option is validated once, from the layer of highest precedence:
+///
+/// \code
+/// QArgumentConfigFile config;
+/// config.load("/etc/myprogram.json");
+///
+/// parser.addConfigFile(config);
+/// auto result = parser.parse();
+/// \endcode
+///
+/// Arguments can be bound to the members of a structure instead, which are
+/// then written while parsing; no QArgumentOption is created for them:
+///
+/// \code
+/// struct Config { QString path; qint64 size = 0; bool verbose = false; };
+///
+/// parser.bind("file", "f", &Config::path);
+/// parser.bind("amount", "s", &Config::size);
+/// parser.bind("verbose", &Config::verbose);
+///
+/// Config config;
+/// auto result = parser.parse(&config);
+/// \endcode
+///
+/// Parsing stops at the first error by default. Tools that show every mistake
+/// at once enable error collection and walk the QArgumentError records; none
+/// of their messages is formatted unless asked for:
+///
+/// \code
+/// parser.setErrorCollectionEnabled(true);
+/// if (parser.parse() == QArgumentParser::Failure)
+/// {
+///     for (const QArgumentError& error : parser.errors())
+///         qDebug() << error.position() << error.argumentIndex() << error.code();
+/// }
+/// \endcode
+///
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,47 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QARGUMENTPARSER_QARGUMENTPARSER_INL
+#define QARGUMENTPARSER_QARGUMENTPARSER_INL
+
+template<typename Struct, typename T>
+inline void QArgumentParser::bind(
+    const QString& option,
+    const QString& argument,
+    T Struct::* member)
+{
+    m_bindings.append(QArgumentBinding::create(option, argument, member));
+}
+
+template<typename Struct>
+inline void QArgumentParser::bind(const QString& option, bool Struct::* member)
+{
+    m_bindings.append(QArgumentBinding::create(option, member));
+}
+
+template<typename Struct>
+inline QArgumentParser::ResultType QArgumentParser::parse(Struct* target)
+{
+    return parseBound(QArgumentBinding::structure<Struct>(), target);
+}
+
+#endif
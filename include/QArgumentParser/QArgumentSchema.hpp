@@ -0,0 +1,396 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTSCHEMA_HPP
+#define QARGUMENTPARSER_QARGUMENTSCHEMA_HPP
+
+#include <QArgumentParser/QArgumentParser.hpp>
+
+#include <QVarLengthArray>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Declares the type \p Identifier, which names an option or argument of a
+/// QArgumentSchema. The name is a compile-time constant; no QString is ever
+/// created from it.
+///
+/// \code
+/// QARGUMENT_NAME(File, "file");
+/// \endcode
+///
+////////////////////////////////////////////////////////////////////////////////
+#define QARGUMENT_NAME(Identifier, Text)                \
+    struct Identifier                                   \
+    {                                                   \
+        static const char* text() { return Text; }      \
+        static int size() { return sizeof(Text) - 1; }  \
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+/// \struct QArgumentSchemaType
+/// \brief Maps an argument type to the C++ type it is converted to.
+///
+/// String, File and Directory arguments are views of the command line; call
+/// QArgumentToken::toString to obtain a QString. List types are not supported
+/// by compile-time schemas.
+///
+////////////////////////////////////////////////////////////////////////////////
+template<QArgumentValidatorOption::ArgumentType Type> struct QArgumentSchemaType;
+
+template<> struct QArgumentSchemaType<QArgumentValidatorOption::Char>       { typedef char Value; };
+template<> struct QArgumentSchemaType<QArgumentValidatorOption::UInt8>      { typedef uchar Value; };
+template<> struct QArgumentSchemaType<QArgumentValidatorOption::Int16>      { typedef short Value; };
+template<> struct QArgumentSchemaType<QArgumentValidatorOption::UInt16>     { typedef ushort Value; };
+template<> struct QArgumentSchemaType<QArgumentValidatorOption::Int32>      { typedef int Value; };
+template<> struct QArgumentSchemaType<QArgumentValidatorOption::UInt32>     { typedef uint Value; };
+template<> struct QArgumentSchemaType<QArgumentValidatorOption::Int64>      { typedef qint64 Value; };
+template<> struct QArgumentSchemaType<QArgumentValidatorOption::UInt64>     { typedef quint64 Value; };
+template<> struct QArgumentSchemaType<QArgumentValidatorOption::String>     { typedef QArgumentToken Value; };
+template<> struct QArgumentSchemaType<QArgumentValidatorOption::File>       { typedef QArgumentToken Value; };
+template<> struct QArgumentSchemaType<QArgumentValidatorOption::Directory>  { typedef QArgumentToken Value; };
+template<> struct QArgumentSchemaType<QArgumentValidatorOption::MappedFile> { typedef QSharedPointer<const QArgumentMappedFile> Value; };
+
+////////////////////////////////////////////////////////////////////////////////
+/// \struct QArgumentSchemaArgument
+/// \brief Declares the argument \p Name of the given \p Type.
+///
+////////////////////////////////////////////////////////////////////////////////
+template<typename Name, QArgumentValidatorOption::ArgumentType Type>
+struct QArgumentSchemaArgument
+{
+    typedef Name                                       NameType;
+    typedef typename QArgumentSchemaType<Type>::Value Value;
+    typedef std::integral_constant<QArgumentValidatorOption::ArgumentType, Type> Tag;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// \struct QArgumentSchemaOption
+/// \brief Declares the option \p Name, taking the given \p Arguments.
+///
+////////////////////////////////////////////////////////////////////////////////
+template<typename Name, bool IsOptional, typename... Arguments>
+struct QArgumentSchemaOption
+{
+    typedef Name                                   NameType;
+    typedef std::tuple<Arguments...>               ArgumentTypes;
+    typedef std::tuple<typename Arguments::Value...> Values;
+
+    enum
+    {
+        Optional      = IsOptional,
+        ArgumentCount = sizeof...(Arguments)
+    };
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// \struct QArgumentSchemaIndexOf
+/// \brief Finds the declaration named \p Name within the tuple \p Tuple.
+///
+////////////////////////////////////////////////////////////////////////////////
+template<typename Name, typename Tuple> struct QArgumentSchemaIndexOf;
+
+template<typename Name>
+struct QArgumentSchemaIndexOf<Name, std::tuple<>>
+{
+    enum { Value = 0 };
+};
+
+template<typename Name, typename First, typename... Rest>
+struct QArgumentSchemaIndexOf<Name, std::tuple<First, Rest...>>
+{
+    enum
+    {
+        Value = std::is_same<Name, typename First::NameType>::value
+            ? 0
+            : 1 + QArgumentSchemaIndexOf<Name, std::tuple<Rest...>>::Value
+    };
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// \struct QArgumentSchemaLookup
+/// \brief Resolves the declaration named \p Name within \p Tuple at compile
+///        time, failing to compile if there is none.
+///
+////////////////////////////////////////////////////////////////////////////////
+template<typename Name, typename Tuple>
+struct QArgumentSchemaLookup
+{
+    enum { Index = QArgumentSchemaIndexOf<Name, Tuple>::Value };
+    static_assert(Index < std::tuple_size<Tuple>::value, "QArgumentSchema: unknown name.");
+
+    typedef typename std::tuple_element<Index, Tuple>::type Type;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentSchemaBase
+/// \brief Holds the parts of QArgumentSchema that do not depend on the schema.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+class QARGUMENTPARSER_API QArgumentSchemaBase
+{
+public:
+
+    template<QArgumentValidatorOption::ArgumentType Type>
+    using Tag = std::integral_constant<QArgumentValidatorOption::ArgumentType, Type>;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the error along with result QArgumentParser::Failure.
+    ///
+    /// \return The error.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentError& error() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the error message along with result QArgumentParser::Failure.
+    /// The message is formatted by the first call after the failure.
+    ///
+    /// \return The error message.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QString& errorMessage() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the option indicator. By default, this is a dash ('-').
+    ///
+    /// \return The option indicator.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QString& optionIndicator() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the option indicator. By default, this is a dash ('-').
+    ///
+    /// \param[in] indicator The new option indicator.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setOptionIndicator(const QString& indicator);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Converts the argument \p s to the type selected by the tag. The overload
+    /// is chosen at compile time; acceptance and error messages are the same
+    /// as those of QArgumentValidator.
+    ///
+    /// \param[in] s The argument as it was passed on the command line.
+    /// \param[out] value The converted value.
+    /// \param[out] error The error.
+    /// \return True if valid, false otherwise.
+    ///
+    /// \remarks Used by QArgumentSchema; there is no need to call these.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    static bool convert(Tag<QArgumentValidatorOption::Char>, const QArgumentToken& s, char* value, QArgumentError* error);
+    static bool convert(Tag<QArgumentValidatorOption::UInt8>, const QArgumentToken& s, uchar* value, QArgumentError* error);
+    static bool convert(Tag<QArgumentValidatorOption::Int16>, const QArgumentToken& s, short* value, QArgumentError* error);
+    static bool convert(Tag<QArgumentValidatorOption::UInt16>, const QArgumentToken& s, ushort* value, QArgumentError* error);
+    static bool convert(Tag<QArgumentValidatorOption::Int32>, const QArgumentToken& s, int* value, QArgumentError* error);
+    static bool convert(Tag<QArgumentValidatorOption::UInt32>, const QArgumentToken& s, uint* value, QArgumentError* error);
+    static bool convert(Tag<QArgumentValidatorOption::Int64>, const QArgumentToken& s, qint64* value, QArgumentError* error);
+    static bool convert(Tag<QArgumentValidatorOption::UInt64>, const QArgumentToken& s, quint64* value, QArgumentError* error);
+    static bool convert(Tag<QArgumentValidatorOption::String>, const QArgumentToken& s, QArgumentToken* value, QArgumentError* error);
+    static bool convert(Tag<QArgumentValidatorOption::File>, const QArgumentToken& s, QArgumentToken* value, QArgumentError* error);
+    static bool convert(Tag<QArgumentValidatorOption::Directory>, const QArgumentToken& s, QArgumentToken* value, QArgumentError* error);
+    static bool convert(Tag<QArgumentValidatorOption::MappedFile>, const QArgumentToken& s, QSharedPointer<const QArgumentMappedFile>* value, QArgumentError* error);
+
+protected:
+
+    QArgumentSchemaBase();
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    static bool matches(const QArgumentToken&, const char*, int);
+    void setInvalidOption(const QArgumentToken&);
+    void setInvalidCount(const char*, int, int);
+    void setMissingRequired(const char*);
+    void clearError();
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    QString         m_optionIndicator;
+    QArgumentError  m_error;
+    mutable QString m_errorMessage;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// \struct QArgumentSchemaConverter
+/// \brief Converts the arguments of \p Option, starting at index \p Index.
+///
+////////////////////////////////////////////////////////////////////////////////
+template<typename Option, int Index = 0, bool IsEnd = (Index == Option::ArgumentCount)>
+struct QArgumentSchemaConverter
+{
+    static bool convert(const QArgumentToken*, typename Option::Values*, QArgumentError*);
+};
+
+template<typename Option, int Index>
+struct QArgumentSchemaConverter<Option, Index, true>
+{
+    static bool convert(const QArgumentToken*, typename Option::Values*, QArgumentError*);
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentSchema
+/// \brief Parses options declared at compile time into typed storage.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+template<typename... Options>
+class QArgumentSchema : public QArgumentSchemaBase
+{
+public:
+
+    typedef std::tuple<Options...> OptionTypes;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the declaration of the option named \p Name.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename Name>
+    using OptionOf = typename QArgumentSchemaLookup<Name, OptionTypes>::Type;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the C++ type of the argument \p Argument of option \p Option.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename Option, typename Argument>
+    using ValueOf = typename QArgumentSchemaLookup<Argument,
+        typename OptionOf<Option>::ArgumentTypes>::Type::Value;
+
+    QArgumentSchema();
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Parses the parameters of 'int main(int argc, char* argv[])', skipping
+    /// the first argument.
+    ///
+    /// \param[in] argc The argument count.
+    /// \param[in] argv The arguments themselves.
+    /// \return The type of the result.
+    ///
+    /// \remarks The arguments are not copied and must outlive the results.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentParser::ResultType parse(int argc, char* argv[]);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Parses the UTF-8 encoded, null-terminated \p arguments.
+    ///
+    /// \param[in] arguments The arguments to parse.
+    /// \param[in] count The amount of arguments.
+    /// \return The type of the result.
+    ///
+    /// \remarks The arguments are not copied and must outlive the results.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentParser::ResultType parse(const char* const* arguments, int count);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether the option named \p Name was given.
+    ///
+    /// \return True if the option was parsed, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename Name> bool isSet() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the argument \p Argument of the option \p Option, converted
+    /// during parsing. Misspelled names do not compile.
+    ///
+    /// \return The converted argument, or a default-constructed value if the
+    ///         option was not given.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename Option, typename Argument>
+    const ValueOf<Option, Argument>& argument() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////////////////////
+    enum { OptionCount = sizeof...(Options) };
+
+    template<int I>
+    using Index = std::integral_constant<int, I>;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    bool commit(const QArgumentToken&, const QArgumentToken*, int, Index<OptionCount>);
+    template<int I> bool commit(const QArgumentToken&, const QArgumentToken*, int, Index<I>);
+    bool isMissingRequired(Index<OptionCount>);
+    template<int I> bool isMissingRequired(Index<I>);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    std::tuple<typename Options::Values...> m_values;
+    bool                                    m_isSet[OptionCount > 0 ? OptionCount : 1];
+};
+
+// Template definitions
+#include "QArgumentSchema.inl"
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentSchema
+///
+/// A QArgumentSchema is the compile-time counterpart of QArgumentValidator.
+/// Options, arguments and their types are template parameters, so declaring
+/// the schema does not allocate anything, options are matched against names
+/// known at compile time and every argument is converted by a function chosen
+/// at compile time. The results are stored in typed fields and retrieved
+/// without any lookup:
+///
+/// \code
+/// QARGUMENT_NAME(File, "file");
+/// QARGUMENT_NAME(Amount, "amount");
+/// QARGUMENT_NAME(Path, "f");
+/// QARGUMENT_NAME(Size, "s");
+///
+/// QArgumentSchema<
+///     QArgumentSchemaOption<File, false,
+///         QArgumentSchemaArgument<Path, QArgumentValidatorOption::File>>,
+///     QArgumentSchemaOption<Amount, true,
+///         QArgumentSchemaArgument<Size, QArgumentValidatorOption::Int64>>
+/// > schema;
+///
+/// if (schema.parse(argc, argv) == QArgumentParser::Success)
+/// {
+///     QString path = schema.argument<File, Path>().toString();
+///     qint64  size = schema.argument<Amount, Size>();
+/// }
+/// \endcode
+///
+/// Parsing follows the same rules and reports the same errors as
+/// QArgumentParser with a QArgumentValidator, apart from response files,
+/// which compile-time schemas do not expand.
+///
+////////////////////////////////////////////////////////////////////////////////
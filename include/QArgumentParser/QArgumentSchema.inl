@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QARGUMENTPARSER_QARGUMENTSCHEMA_INL
+#define QARGUMENTPARSER_QARGUMENTSCHEMA_INL
+
+template<typename Option, int Index, bool IsEnd>
+inline bool QArgumentSchemaConverter<Option, Index, IsEnd>::convert(
+    const QArgumentToken* args,
+    typename Option::Values* values,
+    QArgumentError* error)
+{
+    typedef typename std::tuple_element<Index, typename Option::ArgumentTypes>::type Argument;
+
+    if (!QArgumentSchemaBase::convert(typename Argument::Tag(), args[Index], &std::get<Index>(*values), error))
+    {
+        error->setArgument(args[Index], Index);
+        return false;
+    }
+
+    return QArgumentSchemaConverter<Option, Index + 1>::convert(args, values, error);
+}
+
+template<typename Option, int Index>
+inline bool QArgumentSchemaConverter<Option, Index, true>::convert(
+    const QArgumentToken*,
+    typename Option::Values*,
+    QArgumentError*)
+{
+    return true;
+}
+
+template<typename... Options>
+inline QArgumentSchema<Options...>::QArgumentSchema()
+{
+    std::memset(m_isSet, 0, sizeof(m_isSet));
+}
+
+template<typename... Options>
+inline QArgumentParser::ResultType QArgumentSchema<Options...>::parse(int argc, char* argv[])
+{
+    return argc > 0 ? parse(argv + 1, argc - 1) : QArgumentParser::HelpRequested;
+}
+
+template<typename... Options>
+inline QArgumentParser::ResultType QArgumentSchema<Options...>::parse(
+    const char* const* arguments,
+    int count)
+{
+    // We could potentially get errors when having zero arguments.
+    if (count == 0)
+    {
+        return QArgumentParser::HelpRequested;
+    }
+
+    m_values = std::tuple<typename Options::Values...>();
+    std::memset(m_isSet, 0, sizeof(m_isSet));
+    clearError();
+
+    // Up to 16 arguments per option are kept on the stack.
+    QArgumentToken option;
+    QVarLengthArray<QArgumentToken, 16> args;
+
+    for (int i = 0; i < count; i++)
+    {
+        auto token = QArgumentToken::fromUtf8(arguments[i]).trimmed();
+        auto indicator = token.prefixLength(m_optionIndicator);
+        if (indicator != -1)
+        {
+            token = token.mid(indicator);
+            if (token.equals(QLatin1String("h")))
+            {
+                return QArgumentParser::HelpRequested;
+            }
+
+            if (!option.isEmpty() && !commit(option, args.constData(), args.size(), Index<0>()))
+            {
+                return QArgumentParser::Failure;
+            }
+
+            option = token;
+            args.clear();
+        }
+        else if (!token.isEmpty())
+        {
+            args.append(token);
+        }
+    }
+
+    // Validates the last remaining option.
+    if (!commit(option, args.constData(), args.size(), Index<0>()))
+    {
+        return QArgumentParser::Failure;
+    }
+
+    // Required options must be provided.
+    if (isMissingRequired(Index<0>()))
+    {
+        return QArgumentParser::Failure;
+    }
+
+    return QArgumentParser::Success;
+}
+
+template<typename... Options>
+template<typename Name>
+inline bool QArgumentSchema<Options...>::isSet() const
+{
+    return m_isSet[QArgumentSchemaLookup<Name, OptionTypes>::Index];
+}
+
+template<typename... Options>
+template<typename Option, typename Argument>
+inline const typename QArgumentSchema<Options...>::template ValueOf<Option, Argument>&
+QArgumentSchema<Options...>::argument() const
+{
+    typedef QArgumentSchemaLookup<Option, OptionTypes> OptionLookup;
+    typedef QArgumentSchemaLookup<Argument, typename OptionLookup::Type::ArgumentTypes> ArgumentLookup;
+
+    return std::get<ArgumentLookup::Index>(std::get<OptionLookup::Index>(m_values));
+}
+
+template<typename... Options>
+inline bool QArgumentSchema<Options...>::commit(
+    const QArgumentToken& name,
+    const QArgumentToken*,
+    int,
+    Index<OptionCount>)
+{
+    setInvalidOption(name);
+    return false;
+}
+
+template<typename... Options>
+template<int I>
+inline bool QArgumentSchema<Options...>::commit(
+    const QArgumentToken& name,
+    const QArgumentToken* args,
+    int count,
+    Index<I>)
+{
+    typedef typename std::tuple_element<I, OptionTypes>::type Option;
+    typedef typename Option::NameType Name;
+
+    // The comparisons against all declared names are unrolled at compile time.
+    if (!matches(name, Name::text(), Name::size()))
+    {
+        return commit(name, args, count, Index<I + 1>());
+    }
+
+    if (count != Option::ArgumentCount)
+    {
+        setInvalidCount(Name::text(), count, Option::ArgumentCount);
+        return false;
+    }
+
+    if (!QArgumentSchemaConverter<Option>::convert(args, &std::get<I>(m_values), &m_error))
+    {
+        m_error.setOption(name);
+        return false;
+    }
+
+    m_isSet[I] = true;
+    return true;
+}
+
+template<typename... Options>
+inline bool QArgumentSchema<Options...>::isMissingRequired(Index<OptionCount>)
+{
+    return false;
+}
+
+template<typename... Options>
+template<int I>
+inline bool QArgumentSchema<Options...>::isMissingRequired(Index<I>)
+{
+    typedef typename std::tuple_element<I, OptionTypes>::type Option;
+
+    if (!Option::Optional && !m_isSet[I])
+    {
+        setMissingRequired(Option::NameType::text());
+        return true;
+    }
+
+    return isMissingRequired(Index<I + 1>());
+}
+
+#endif
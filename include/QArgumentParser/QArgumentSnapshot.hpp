@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTSNAPSHOT_HPP
+#define QARGUMENTPARSER_QARGUMENTSNAPSHOT_HPP
+
+#include <QArgumentParser/QArgumentOptionView.hpp>
+#include <QArgumentParser/QArgumentValidator.hpp>
+
+#include <QSharedPointer>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentSnapshot
+/// \brief Immutable copy of the results of one parse.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+class QARGUMENTPARSER_API QArgumentSnapshot
+{
+public:
+
+    QArgumentSnapshot(const QArgumentSnapshot& other) = delete;
+    QArgumentSnapshot& operator=(const QArgumentSnapshot& other) = delete;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the first argument of the parse, i.e. the program name.
+    ///
+    /// \return The first argument.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QString& firstArgument() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the option called \p name without copying it.
+    ///
+    /// \param[in] name The name of the option.
+    /// \return The option; it has no arguments if it was not parsed.
+    ///
+    /// \remarks The option lives as long as this snapshot.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentOption& option(const QString& name) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves a view of the option called \p name.
+    ///
+    /// \param[in] name The name of the option.
+    /// \return The view; it is invalid if the option was not parsed.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentOptionView optionView(const QString& name) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the amount of parsed options.
+    ///
+    /// \return The amount of options.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int optionCount() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves an iterator to the first parsed option, in command line order.
+    ///
+    /// \return The iterator.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentOptionView::Iterator begin() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves an iterator past the last parsed option.
+    ///
+    /// \return The iterator.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentOptionView::Iterator end() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the validator the options were parsed with.
+    ///
+    /// \return The validator.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentValidator& validator() const;
+
+private:
+
+    QArgumentSnapshot();
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    QSharedPointer<const QArgumentValidator> m_validator;
+    QArgumentOption                          m_defaultOption;
+    QVector<QArgumentOption>                 m_options;
+    QVector<int>                             m_optionSlots;
+    QString                                  m_firstArgument;
+    QByteArray                               m_utf8;
+    QString                                  m_utf16;
+
+    friend class QArgumentParser;
+};
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentSnapshot
+///
+/// QArgumentParser::snapshot copies the results of the last parse into a new
+/// QArgumentSnapshot, including the text of every argument, so the snapshot
+/// depends neither on the parser nor on the arguments it parsed. It is never
+/// modified afterwards: any amount of threads may read it at once without
+/// locking. Looking up options and views does not allocate memory, and
+/// neither does reading numeric, QString, QFileInfo, QFile* or QArgumentList
+/// arguments: the text of every argument is converted to QString once, and
+/// the QFile handles of File arguments are created with the snapshot.
+///
+/// Snapshots are handed out as std::shared_ptr, which can be published to
+/// other threads atomically, e.g. when the configuration is reloaded:
+///
+/// \code
+/// std::shared_ptr<const QArgumentSnapshot> g_config;
+///
+/// // reloading thread
+/// if (parser.parse() == QArgumentParser::Success)
+///     std::atomic_store(&g_config, parser.snapshot());
+///
+/// // worker threads
+/// auto config = std::atomic_load(&g_config);
+/// int port = config->optionView("p").argument<int>("port");
+/// \endcode
+///
+/// Readers keep the snapshot they loaded alive until they release it, even if
+/// a newer one was published meanwhile.
+///
+/// The QFile handle of an argument is shared by all readers, which have to
+/// synchronize opening and reading it; arguments of any other type than File
+/// have no handle in a snapshot.
+///
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTSTATISTICS_HPP
+#define QARGUMENTPARSER_QARGUMENTSTATISTICS_HPP
+
+#include <QArgumentParser/Config.hpp>
+
+#include <QByteArray>
+#include <QElapsedTimer>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentStatistics
+/// \brief Holds the timings and counters gathered during one parse.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+class QARGUMENTPARSER_API QArgumentStatistics
+{
+public:
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Defines the phases the time of a parse is attributed to.
+    /// \enum Phase
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    enum Phase
+    {
+        Tokenization,
+        Lookup,
+        Validation,
+        PathCheck,
+        RequiredCheck,
+        PhaseCount
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Defines the events counted during a parse.
+    /// \enum Counter
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    enum Counter
+    {
+        Tokens,
+        Options,
+        StringAllocations,
+        FileProbes,
+        CounterCount
+    };
+
+    QArgumentStatistics();
+    QArgumentStatistics(const QArgumentStatistics& other) = default;
+    QArgumentStatistics& operator=(const QArgumentStatistics& other) = default;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the wall time spent in the given \p phase.
+    ///
+    /// \param[in] phase The phase of the parse.
+    /// \return The time in nanoseconds.
+    ///
+    /// \remarks QArgumentStatistics::Tokenization covers reading argv and
+    ///          response files, i.e. all time not spent in the other phases.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    qint64 elapsed(Phase phase) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the wall time of the entire parse.
+    ///
+    /// \return The time in nanoseconds.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    qint64 totalElapsed() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves how often the given event occurred.
+    ///
+    /// \param[in] counter The event.
+    /// \return The amount of events.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    qint64 count(Counter counter) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the amount of heap memory held by the parsed options.
+    ///
+    /// \return The amount of bytes, not counting memory-mapped files.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    qint64 retainedBytes() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Formats all timings and counters as a single line of JSON.
+    ///
+    /// \return The UTF-8 encoded JSON object.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QByteArray toJson() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Counts one or more events in the statistics of the parse running on
+    /// the calling thread. Does nothing if that parse does not collect any.
+    ///
+    /// \param[in] counter The event.
+    /// \param[in] amount The amount of events.
+    ///
+    /// \remarks Used by the library; there is no need to call this yourself.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    static void record(Counter counter, qint64 amount = 1);
+
+private:
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////////////////////
+    class Scope
+    {
+    public:
+
+        Scope(QArgumentStatistics*);
+       ~Scope();
+
+    private:
+
+        QArgumentStatistics* m_previous;
+        QArgumentStatistics* m_statistics;
+        QElapsedTimer        m_timer;
+    };
+
+    class PhaseTimer
+    {
+    public:
+
+        PhaseTimer(Phase);
+       ~PhaseTimer();
+
+    private:
+
+        QArgumentStatistics* m_statistics;
+        Phase                m_phase;
+        QElapsedTimer        m_timer;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    qint64 m_elapsed[PhaseCount];
+    qint64 m_counters[CounterCount];
+    qint64 m_totalElapsed;
+    qint64 m_retainedBytes;
+
+    friend class QArgumentParser;
+};
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentStatistics
+///
+/// Statistics tell where the time of a slow start went: reading the arguments,
+/// looking up options, converting numbers, querying the file system or
+/// checking for required options. They are collected only when enabled via
+/// QArgumentParser::setStatisticsEnabled or by setting the environment
+/// variable QARGUMENTPARSER_STATISTICS, which additionally prints them to
+/// stderr after every parse:
+///
+/// \code
+/// $ QARGUMENTPARSER_STATISTICS=1 ./tool -file input.txt
+/// {"elapsed_ns":{"total":48211,"tokenization":3190,...},"tokens":2,...}
+/// \endcode
+///
+/// Disabled statistics cost one branch per counted event. Defining
+/// QARGUMENTPARSER_NO_STATISTICS when building the library removes them.
+///
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTSTORAGE_HPP
+#define QARGUMENTPARSER_QARGUMENTSTORAGE_HPP
+
+#include <QArgumentParser/QArgumentArena.hpp>
+#include <QArgumentParser/QArgumentFileCache.hpp>
+#include <QArgumentParser/QArgumentValue.hpp>
+
+#include <QFile>
+#include <QMutex>
+#include <QSharedData>
+#include <QSharedPointer>
+#include <QVector>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentStorage
+/// \brief Holds the converted arguments of all options of one parse.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+class QARGUMENTPARSER_API QArgumentStorage : public QSharedData
+{
+public:
+
+    QArgumentStorage() = default;
+    QArgumentStorage(const QArgumentStorage& other);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the amount of values stored.
+    ///
+    /// \return The amount of values.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int valueCount() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the value at the given \p index.
+    ///
+    /// \param[in] index The index of the value.
+    /// \return The value, or an invalid one if out of range.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentValue& valueAt(int index) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the file system information gathered while parsing.
+    ///
+    /// \return The file cache.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentFileCache& files() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether anything besides its owner refers to this storage,
+    /// e.g. an option that was retrieved from the parser and is still alive.
+    ///
+    /// \return True if shared, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isShared() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves a handle to the file named by the value at \p index. The
+    /// handle is created on first use and lives as long as this storage. Any
+    /// amount of threads may retrieve handles concurrently.
+    ///
+    /// \param[in] index The index of the value.
+    /// \return The handle, which is not opened, or nullptr if out of range.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QFile* fileHandle(int index) const;
+
+private:
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    void clear();
+    void createFileHandles();
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    QVector<QArgumentValue>                m_values;
+    QArgumentFileCache                     m_files;
+    QArgumentArena                         m_arena;
+    QVector<QSharedPointer<QFile>>         m_responseFiles;
+    QVector<QByteArray>                    m_tokenStorage;
+    mutable QVector<QSharedPointer<QFile>> m_fileHandles;
+    mutable QMutex                         m_fileHandleMutex;
+    bool                                   m_hasFixedFileHandles = false;
+
+    friend class QArgumentParser;
+};
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentStorage
+///
+/// All options of one parse keep their arguments in a single QArgumentStorage
+/// and refer to their range within it, rather than owning a container each.
+/// Copying an option therefore only adds a reference to the storage.
+///
+/// When the next parse begins and no option of the previous one is alive
+/// anymore, QArgumentParser clears the storage and reuses its memory. Options
+/// that are still alive keep the storage they refer to, and the parser moves
+/// on to a new one.
+///
+/// The storage is not modified after the parse, except for the file handles
+/// created by QArgumentOption::argument<QFile*>, which are guarded. Hence the
+/// options of one parse may be read on several threads at once. Every
+/// argument has at most one handle, which all reads of it return. The storage
+/// of a QArgumentSnapshot creates the handles of its File arguments up front
+/// and hands them out without locking.
+///
+/// The storage also owns whatever the arguments view besides argv: the mapped
+/// response files, environment values and unescaped tokens of the parse or,
+/// with QArgumentParser::setArenaEnabled, the arena holding the latter. They
+/// live as long as the options referring to them.
+///
+////////////////////////////////////////////////////////////////////////////////
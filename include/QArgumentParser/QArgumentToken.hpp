@@ -0,0 +1,234 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTTOKEN_HPP
+#define QARGUMENTPARSER_QARGUMENTTOKEN_HPP
+
+#include <QArgumentParser/Config.hpp>
+#include <QStringView>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentToken
+/// \brief Non-owning view of one command line token.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+class QARGUMENTPARSER_API QArgumentToken
+{
+public:
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Defines the encoding of the viewed characters.
+    /// \enum Encoding
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    enum Encoding
+    {
+        Utf8,
+        Utf16
+    };
+
+    QArgumentToken();
+    QArgumentToken(const QArgumentToken& other) = default;
+    QArgumentToken& operator=(const QArgumentToken& other) = default;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Creates a token viewing the UTF-8 encoded \p data, e.g. an argv entry.
+    ///
+    /// \param[in] data The characters to view.
+    /// \param[in] size The amount of bytes, or -1 if \p data is null-terminated.
+    /// \return The new token.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    static QArgumentToken fromUtf8(const char* data, int size = -1);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Creates a token viewing the UTF-16 encoded \p view.
+    ///
+    /// \param[in] view The characters to view.
+    /// \return The new token.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    static QArgumentToken fromUtf16(QStringView view);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the encoding of the viewed characters.
+    ///
+    /// \return The encoding.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    Encoding encoding() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the viewed bytes. Only valid for QArgumentToken::Utf8.
+    ///
+    /// \return The first byte of the token; not null-terminated.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const char* utf8() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the viewed characters. Only valid for QArgumentToken::Utf16.
+    ///
+    /// \return The characters of the token.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QStringView utf16() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the amount of code units (bytes or UTF-16 characters).
+    ///
+    /// \return The size of the token.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int size() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether the token has no characters.
+    ///
+    /// \return True if empty, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isEmpty() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the code unit at the given \p index.
+    ///
+    /// \param[in] index The index, which must be in range.
+    /// \return The byte or UTF-16 character at \p index.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    uint unitAt(int index) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the token without leading and trailing whitespace.
+    ///
+    /// \return A view of the trimmed characters.
+    ///
+    /// \remarks Whitespace is what QString::trimmed removes, in UTF-8 tokens
+    ///          as well.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentToken trimmed() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the token starting at the code unit \p position.
+    ///
+    /// \param[in] position The first code unit of the new view.
+    /// \return A view of the remaining characters.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentToken mid(int position) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether the token starts with \p prefix.
+    ///
+    /// \param[in] prefix The prefix to look for.
+    /// \return The amount of code units matched by \p prefix, or -1 if the
+    ///         token does not start with \p prefix.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int prefixLength(const QString& prefix) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether \p other starts with this token.
+    ///
+    /// \param[in] other The string to check.
+    /// \return True if this token is a prefix of \p other, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isPrefixOf(const QString& other) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Compares the token with \p other like QString::compare would.
+    ///
+    /// \param[in] other The string to compare with.
+    /// \return Negative, zero or positive if the token sorts before, equal to
+    ///         or after \p other.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int compare(const QString& other) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether the token equals the Latin-1 string \p other.
+    ///
+    /// \param[in] other The string to compare with.
+    /// \return True if equal, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool equals(QLatin1String other) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Converts the token to a QString. This allocates a new string.
+    ///
+    /// \return The token as QString.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QString toString() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Converts the token to an integer, with the same rules as the QString
+    /// function of the same name. Canonical decimals, i.e. digits with an
+    /// optional minus sign, are converted without copying the characters.
+    ///
+    /// \param[out] ok Set to true on success, false otherwise. May be null.
+    /// \return The converted integer, or zero if the conversion failed.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    short toShort(bool* ok = nullptr) const;
+    ushort toUShort(bool* ok = nullptr) const;
+    int toInt(bool* ok = nullptr) const;
+    uint toUInt(bool* ok = nullptr) const;
+    qint64 toLongLong(bool* ok = nullptr) const;
+    quint64 toULongLong(bool* ok = nullptr) const;
+
+private:
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    const void* m_data;
+    int         m_size;
+    Encoding    m_encoding;
+};
+
+Q_DECLARE_TYPEINFO(QArgumentToken, Q_PRIMITIVE_TYPE);
+
+// Inline accessors
+#include "QArgumentToken.inl"
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentToken
+///
+/// The parser does not convert the command line to QString. Instead, every
+/// token views the storage it was read from, e.g. the argv array passed to
+/// QArgumentParser. Validation and numeric conversion operate on the viewed
+/// characters directly; a QString is only created when asked for one.
+///
+/// A token never owns its characters. It is only valid as long as the storage
+/// it views is alive.
+///
+////////////////////////////////////////////////////////////////////////////////
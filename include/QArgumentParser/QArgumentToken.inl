@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QARGUMENTPARSER_QARGUMENTTOKEN_INL
+#define QARGUMENTPARSER_QARGUMENTTOKEN_INL
+
+inline QArgumentToken::Encoding QArgumentToken::encoding() const
+{
+    return m_encoding;
+}
+
+inline const char* QArgumentToken::utf8() const
+{
+    return static_cast<const char*>(m_data);
+}
+
+inline QStringView QArgumentToken::utf16() const
+{
+    return QStringView(static_cast<const QChar*>(m_data), m_size);
+}
+
+inline int QArgumentToken::size() const
+{
+    return m_size;
+}
+
+inline bool QArgumentToken::isEmpty() const
+{
+    return m_size == 0;
+}
+
+inline uint QArgumentToken::unitAt(int index) const
+{
+    if (m_encoding == Utf8)
+    {
+        return static_cast<uchar>(static_cast<const char*>(m_data)[index]);
+    }
+
+    return static_cast<const QChar*>(m_data)[index].unicode();
+}
+
+#endif
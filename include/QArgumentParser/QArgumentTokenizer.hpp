@@ -0,0 +1,231 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTTOKENIZER_HPP
+#define QARGUMENTPARSER_QARGUMENTTOKENIZER_HPP
+
+#include <QArgumentParser/QArgumentArena.hpp>
+#include <QArgumentParser/QArgumentToken.hpp>
+
+#include <QByteArray>
+#include <QVector>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentTokenizer
+/// \brief Splits a buffer of arguments into tokens without copying it.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+class QARGUMENTPARSER_API QArgumentTokenizer
+{
+public:
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Defines how tokens are separated from each other.
+    /// \enum Mode
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    enum Mode
+    {
+        Whitespace,
+        NulSeparated,
+        Shell
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Initializes a new tokenizer with the given \p mode.
+    ///
+    /// \param[in] mode The separation mode.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentTokenizer(Mode mode = Whitespace);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the separation mode.
+    ///
+    /// \return The separation mode.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    Mode mode() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the offset of the first byte that was not consumed yet.
+    ///
+    /// \return The current position within the data.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int position() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether the input ended within a quoted section.
+    ///
+    /// \return True if a quote was not terminated, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool hasError() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the character starting a comment. By default, this is '\0':
+    /// there are no comments.
+    ///
+    /// \return The comment character.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    char commentCharacter() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the separation mode.
+    ///
+    /// \param[in] mode The separation mode.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setMode(Mode mode);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the character starting a comment, e.g. '#'. Comments start at
+    /// an unquoted comment character at the beginning of a token and end at
+    /// the end of the line. They are ignored by QArgumentTokenizer::NulSeparated.
+    ///
+    /// \param[in] comment The comment character, or '\0' for no comments.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setCommentCharacter(char comment);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies where tokens are stored that can not be viewed in place,
+    /// because quotes or escapes had to be removed from the middle of them.
+    /// By default, the tokenizer keeps them itself.
+    ///
+    /// \param[in] storage The storage for unescaped tokens. May be null.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setStorage(QVector<QByteArray>* storage);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Interns tokens that can not be viewed in place into \p arena instead
+    /// of the storage; identical tokens then share their memory.
+    ///
+    /// \param[in] arena The arena for unescaped tokens. May be null.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setArena(QArgumentArena* arena);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the UTF-8 encoded \p data to tokenize and rewinds to its
+    /// beginning. The data is not copied and must outlive the tokens.
+    ///
+    /// \param[in] data The data to tokenize.
+    /// \param[in] size The amount of bytes.
+    /// \param[in] isFinal False if more data follows, e.g. from a pipe.
+    ///
+    /// \remarks If \p isFinal is false, a token touching the end of \p data
+    ///          is not returned, as it might continue in the next chunk. The
+    ///          caller resumes at QArgumentTokenizer::position once it has
+    ///          more data.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setData(const char* data, int size, bool isFinal = true);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the UTF-16 encoded \p data to tokenize and rewinds to its
+    /// beginning. The data is not copied and must outlive the tokens.
+    ///
+    /// \param[in] data The data to tokenize.
+    /// \param[in] isFinal False if more data follows.
+    ///
+    /// \remarks QArgumentTokenizer::position counts UTF-16 code units then.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setData(QStringView data, bool isFinal = true);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the next token.
+    ///
+    /// \param[out] token The next token.
+    /// \return True if a token was read, false at the end of the data.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool next(QArgumentToken* token);
+
+private:
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename Char> bool nextWords(const Char*, QArgumentToken*);
+    template<typename Char> bool nextNulSeparated(const Char*, QArgumentToken*);
+    template<typename Char> bool skipSpaceAndComments(const Char*);
+    bool isIncomplete(int);
+    QByteArray* storage();
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    const char*          m_data;
+    const char16_t*      m_utf16;
+    int                  m_size;
+    int                  m_position;
+    Mode                 m_mode;
+    char                 m_comment;
+    bool                 m_isFinal;
+    bool                 m_hasError;
+    QVector<QByteArray>* m_storage;
+    QArgumentArena*      m_arena;
+    QVector<QByteArray>  m_ownStorage;
+};
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentTokenizer
+///
+/// The tokenizer reads arguments from a buffer, e.g. a memory-mapped response
+/// file, one token at a time. Tokens are views into the buffer wherever
+/// possible; only tokens with quotes or backslashes in their middle are copied
+/// to the storage set via QArgumentTokenizer::setStorage, or interned into the
+/// arena set via QArgumentTokenizer::setArena.
+///
+/// In QArgumentTokenizer::Whitespace mode, tokens are separated by whitespace.
+/// Single quotes preserve everything up to the closing quote; double quotes
+/// and unquoted text honour backslash escapes. QArgumentTokenizer::Shell mode
+/// follows the POSIX shell instead: within double quotes, a backslash only
+/// escapes '$', '`', '"', '\\' and newlines, and an escaped newline continues
+/// the line. QArgumentTokenizer::NulSeparated mode splits at null bytes only,
+/// as written by 'find -print0'.
+///
+/// UTF-16 data, e.g. a QString, is tokenized the same way without converting
+/// it; its tokens view the UTF-16 code units.
+///
+/// \code
+/// QArgumentTokenizer tokenizer;
+/// QArgumentToken token;
+///
+/// tokenizer.setData(data, size);
+/// while (tokenizer.next(&token))
+/// {
+///     qDebug() << token.toString();
+/// }
+/// \endcode
+///
+////////////////////////////////////////////////////////////////////////////////
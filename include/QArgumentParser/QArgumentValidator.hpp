@@ -24,7 +24,10 @@
 #ifndef QARGUMENTPARSER_QARGUMENTVALIDATOR_HPP
 #define QARGUMENTPARSER_QARGUMENTVALIDATOR_HPP
 
+#include <QArgumentParser/QArgumentError.hpp>
+#include <QArgumentParser/QArgumentFileCache.hpp>
 #include <QArgumentParser/QArgumentValidatorOption.hpp>
+#include <QArgumentParser/QArgumentValue.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////
 /// \class QArgumentValidator
@@ -37,7 +40,7 @@ class QARGUMENTPARSER_API QArgumentValidator
 {
 public:
 
-    QArgumentValidator() = default;
+    QArgumentValidator();
     QArgumentValidator(const QArgumentValidator& other) = default;
     QArgumentValidator& operator=(const QArgumentValidator& other) = default;
 
@@ -50,13 +53,14 @@ public:
     int optionCount() const;
 
     ////////////////////////////////////////////////////////////////////////////
-    /// Retrieves the validator option at the given \p index.
+    /// Retrieves the validator option at the given \p index. Indices follow
+    /// the order in which the options were added.
     ///
     /// \param[in] index The index of the option.
     /// \return The instance of an option with the given index.
     ///
     ////////////////////////////////////////////////////////////////////////////
-    QArgumentValidatorOption optionAt(int index) const;
+    const QArgumentValidatorOption& optionAt(int index) const;
 
     ////////////////////////////////////////////////////////////////////////////
     /// Retrieves the validator option with the given \p name.
@@ -65,20 +69,136 @@ public:
     /// \return The instance of an option with the given name.
     ///
     ////////////////////////////////////////////////////////////////////////////
-    QArgumentValidatorOption option(const QString& name) const;
+    const QArgumentValidatorOption& option(const QString& name) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the index of the option with the given \p name.
+    ///
+    /// \param[in] name The name of the option.
+    /// \return The index of the option, or -1 if it does not exist.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int indexOf(const QString& name) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the index of the option named by the token \p name. Once the
+    /// validator is compiled, this does not convert \p name to a QString.
+    ///
+    /// \param[in] name The name of the option.
+    /// \return The index of the option, or -1 if it does not exist.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int indexOf(const QArgumentToken& name) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the index of the option named by \p name or, if there is no
+    /// such option, of the only option whose name starts with \p name, e.g.
+    /// "amount" for "am".
+    ///
+    /// \param[in] name The name of the option, or an abbreviation of it.
+    /// \return The index of the option, or -1 if it does not exist or the
+    ///         abbreviation is ambiguous.
+    ///
+    /// \remarks Abbreviations are only resolved by a compiled validator.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int indexOfAbbreviation(const QArgumentToken& name) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the indices of all options whose name starts with \p prefix.
+    ///
+    /// \param[in] prefix The start of the names.
+    /// \return The indices of the options, ordered by name.
+    ///
+    /// \remarks Only available after QArgumentValidator::compile was called.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QVector<int> optionsWithPrefix(const QArgumentToken& prefix) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the indices of all options that are not optional.
+    ///
+    /// \return The indices of the required options, in declaration order.
+    ///
+    /// \remarks Only available after QArgumentValidator::compile was called.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QVector<int>& requiredOptions() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether this validator was compiled and not modified since.
+    ///
+    /// \return True if compiled, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isCompiled() const;
 
     ////////////////////////////////////////////////////////////////////////////
     /// Adds a new option for the validator to validate.
     ///
     /// \param[in] option The option to add.
     ///
+    /// \remarks Adding an option to a compiled validator discards the compiled
+    ///          tables; call QArgumentValidator::compile again afterwards.
+    ///
     ////////////////////////////////////////////////////////////////////////////
     void addOption(const QArgumentValidatorOption& option);
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// Compiles the options into flat, immutable lookup tables: a name table
+    /// sorted for binary search, the argument types of all options in one
+    /// contiguous array and the indices of the required options. Parsing with
+    /// a compiled validator does not copy any QArgumentValidatorOption.
+    ///
+    /// \remarks QArgumentParser::setValidator compiles its copy on its own.
+    ///          Compiling an already compiled validator does nothing. The
+    ///          const functions of a compiled validator keep no state of their
+    ///          own and may be called from several threads at once.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void compile();
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Validates the option with the given \p name.
+    ///
+    /// \param[in] name The option to validate.
+    /// \param[in] args The arguments passed to the option.
+    /// \param[out] error Receives the first error.
+    /// \param[out] values Receives the converted arguments, if not null.
+    /// \return True if valid, false otherwise.
+    ///
+    /// \remarks Numeric arguments are converted exactly once while being
+    ///          validated; \p values hands the results on to QArgumentOption.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool validate(
+        const QString& name,
+        const QVector<QArgumentToken>& args,
+        QArgumentError* error,
+        QVector<QArgumentValue>* values = nullptr) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Validates the option with the given \p name and formats the message of
+    /// the first error.
+    ///
+    /// \param[in] name The option to validate.
+    /// \param[in] args The arguments passed to the option.
+    /// \param[out] msg The error message.
+    /// \param[out] values Receives the converted arguments, if not null.
+    /// \return True if valid, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool validate(
+        const QString& name,
+        const QVector<QArgumentToken>& args,
+        QString* msg,
+        QVector<QArgumentValue>* values = nullptr) const;
+
     ////////////////////////////////////////////////////////////////////////////
     /// Validates the option with the given \p name.
     ///
     /// \param[in] name The option to validate.
+    /// \param[in] args The arguments passed to the option.
     /// \param[out] msg The error message.
     /// \return True if valid, false otherwise.
     ///
@@ -88,26 +208,159 @@ public:
         const QVector<QString>& args,
         QString* msg) const;
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// Validates the option at the given \p index. This is the overload used
+    /// by QArgumentParser, which resolves the name once via indexOf().
+    ///
+    /// \param[in] index The index of the option to validate.
+    /// \param[in] args The arguments passed to the option.
+    /// \param[out] error Receives the first error.
+    /// \param[out] values Receives the converted arguments, if not null.
+    /// \param[in,out] files Receives the File and Directory checks, if not null.
+    /// \return True if valid, false otherwise.
+    ///
+    /// \remarks Checks added to \p files are deferred until validatePaths().
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool validate(
+        int index,
+        const QVector<QArgumentToken>& args,
+        QArgumentError* error,
+        QVector<QArgumentValue>* values = nullptr,
+        QArgumentFileCache* files = nullptr) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Validates the option at the given \p index and, unlike the other
+    /// overloads, does not stop at the first invalid argument.
+    ///
+    /// \param[in] index The index of the option to validate.
+    /// \param[in] args The arguments passed to the option.
+    /// \param[out] errors Receives every error, in argument order.
+    /// \param[out] values Receives the converted arguments, if not null.
+    /// \param[in,out] files Receives the File and Directory checks, if not null.
+    /// \return True if valid, false otherwise.
+    ///
+    /// \remarks The arguments are not validated one by one if their count is
+    ///          wrong; that is reported as a single error.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool validate(
+        int index,
+        const QVector<QArgumentToken>& args,
+        QVector<QArgumentError>* errors,
+        QVector<QArgumentValue>* values = nullptr,
+        QArgumentFileCache* files = nullptr) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Validates the option at the given \p index and formats the message of
+    /// the first error.
+    ///
+    /// \param[in] index The index of the option to validate.
+    /// \param[in] args The arguments passed to the option.
+    /// \param[out] msg The error message.
+    /// \param[out] values Receives the converted arguments, if not null.
+    /// \param[in,out] files Receives the File and Directory checks, if not null.
+    /// \return True if valid, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool validate(
+        int index,
+        const QVector<QArgumentToken>& args,
+        QString* msg,
+        QVector<QArgumentValue>* values = nullptr,
+        QArgumentFileCache* files = nullptr) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Runs the File and Directory checks deferred to \p files.
+    ///
+    /// \param[in,out] files The checks collected by validate().
+    /// \param[out] error Receives the error of the first failing check.
+    /// \return True if all paths exist, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool validatePaths(QArgumentFileCache* files, QArgumentError* error) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Runs the File and Directory checks deferred to \p files and reports
+    /// every failing one.
+    ///
+    /// \param[in,out] files The checks collected by validate().
+    /// \param[out] errors Receives the errors, in the order of the checks.
+    /// \return True if all paths exist, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool validatePaths(QArgumentFileCache* files, QVector<QArgumentError>* errors) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Runs the File and Directory checks deferred to \p files.
+    ///
+    /// \param[in,out] files The checks collected by validate().
+    /// \param[out] msg The error message for the first failing check.
+    /// \return True if all paths exist, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool validatePaths(QArgumentFileCache* files, QString* msg) const;
+
 private:
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////////////////////
+    struct Report;
+
     ////////////////////////////////////////////////////////////////////////////
     // Functions
     ////////////////////////////////////////////////////////////////////////////
-    bool validateChar(const QString&, QString*) const;
-    bool validateUChar(const QString&, QString*) const;
-    bool validateShort(const QString&, QString*) const;
-    bool validateUShort(const QString&, QString*) const;
-    bool validateInt(const QString&, QString*) const;
-    bool validateUInt(const QString&, QString*) const;
-    bool validateInt64(const QString&, QString*) const;
-    bool validateUInt64(const QString&, QString*) const;
-    bool validateFile(const QString&, QString*) const;
-    bool validateDirectory(const QString&, QString*) const;
+    static bool validateChar(const QArgumentToken&, QArgumentValue*, QArgumentError*);
+    static bool validateUChar(const QArgumentToken&, QArgumentValue*, QArgumentError*);
+    static bool validateShort(const QArgumentToken&, QArgumentValue*, QArgumentError*);
+    static bool validateUShort(const QArgumentToken&, QArgumentValue*, QArgumentError*);
+    static bool validateInt(const QArgumentToken&, QArgumentValue*, QArgumentError*);
+    static bool validateUInt(const QArgumentToken&, QArgumentValue*, QArgumentError*);
+    static bool validateInt64(const QArgumentToken&, QArgumentValue*, QArgumentError*);
+    static bool validateUInt64(const QArgumentToken&, QArgumentValue*, QArgumentError*);
+    static bool validateFile(const QArgumentToken&, QArgumentValue*, QArgumentError*);
+    static bool validateDirectory(const QArgumentToken&, QArgumentValue*, QArgumentError*);
+    static bool validateMappedFile(const QArgumentToken&, QArgumentValue*, QArgumentError*);
+    bool validate(
+        int,
+        const QVector<QArgumentToken>&,
+        const QArgumentError&,
+        QArgumentError*,
+        QVector<QArgumentError>*,
+        QVector<QArgumentValue>*,
+        QArgumentFileCache*) const;
+    bool validateArguments(
+        int,
+        const QVector<QArgumentToken>&,
+        const Report&,
+        QVector<QArgumentValue>*,
+        QArgumentFileCache*) const;
+    bool validateList(
+        QArgumentValidatorOption::ArgumentType,
+        const QString&,
+        const QArgumentToken*,
+        int,
+        int,
+        QArgumentValue*,
+        const Report&,
+        QArgumentFileCache*) const;
+    static bool resolvePaths(QArgumentFileCache*, const Report&);
+    int prefixRange(const QArgumentToken&, int*) const;
 
     ////////////////////////////////////////////////////////////////////////////
     // Members
     ////////////////////////////////////////////////////////////////////////////
-    QMap<QString, QArgumentValidatorOption> m_options;
+    QVector<QArgumentValidatorOption>               m_options;
+    QHash<QString, int>                             m_optionIndices;
+    QVector<int>                                    m_sortedOptions;
+    QVector<QArgumentValidatorOption::ArgumentType> m_types;
+    QVector<int>                                    m_typeOffsets;
+    QVector<int>                                    m_requiredOptions;
+    bool                                            m_isCompiled;
+
+    friend class QArgumentParser;
+    friend class QArgumentSchemaBase;
 };
 
 #endif
@@ -129,6 +382,18 @@ private:
 /// parser.setValidator(validator);
 /// \endcode
 ///
+/// Tools declaring many options may call QArgumentValidator::compile once the
+/// validator is complete; the parser then dispatches every option through the
+/// compiled tables instead of looking up and copying the declared options.
+/// Since names sharing a prefix are adjacent in the sorted name table, the
+/// compiled validator also resolves abbreviations and lists completions by
+/// bisection, without visiting the other options.
+/// A compiled validator can be shared among the parsers of several threads.
+///
+/// Failures are described by QArgumentError records; their messages are only
+/// formatted on request. The overloads taking a list of errors keep going past
+/// the first invalid argument and report all of them.
+///
 /// In order to know how to receive the arguments with their correct types, see
 /// the documentation of the ::QArgumentOption class.
 ///
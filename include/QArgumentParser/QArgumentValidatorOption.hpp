@@ -25,7 +25,10 @@
 #define QARGUMENTPARSER_QARGUMENTVALIDATOROPTION_HPP
 
 #include <QArgumentParser/Config.hpp>
-#include <QMap>
+#include <QByteArray>
+#include <QHash>
+#include <QStringList>
+#include <QVector>
 
 ////////////////////////////////////////////////////////////////////////////////
 /// \class QArgumentValidatorOption
@@ -56,7 +59,12 @@ public:
         UInt64,
         String,
         File,
-        Directory
+        Directory,
+        MappedFile,
+        Int32List,
+        UInt64List,
+        StringList,
+        FileList
     };
 
     QArgumentValidatorOption(const QArgumentValidatorOption& other) = default;
@@ -78,14 +86,33 @@ public:
     ////////////////////////////////////////////////////////////////////////////
     const QString& option() const;
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the amount of declared arguments.
+    ///
+    /// \return The amount of arguments.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int argumentCount() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the index of the named argument \p name. Indices follow the
+    /// order in which the arguments were added.
+    ///
+    /// \param[in] name The named argument.
+    /// \return The index of the argument, or -1 if it does not exist.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int argumentIndex(const QString& name) const;
+
     ////////////////////////////////////////////////////////////////////////////
     /// Retrieves the argument name at the given \p index.
     ///
     /// \param[in] index The index of the argument name to get.
-    /// \returns The argument name at \p index.
+    /// \returns The argument name at \p index, or a null string if \p index
+    ///          is out of range.
     ///
     ////////////////////////////////////////////////////////////////////////////
-    const QString argumentName(int index) const;
+    const QString& argumentName(int index) const;
 
     ////////////////////////////////////////////////////////////////////////////
     /// Retrieves the type of the named argument \p arg.
@@ -111,6 +138,40 @@ public:
     ////////////////////////////////////////////////////////////////////////////
    ArgumentType argumentType(int index) const;
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the index of the list argument, which takes all arguments
+    /// that are not taken by the other declared arguments.
+    ///
+    /// \return The index of the first list argument, or -1 if there is none.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int listIndex() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the least amount of elements of the list argument.
+    ///
+    /// \return The minimum element count, or 0 if there is no list.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int listMinimum() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the greatest amount of elements of the list argument.
+    ///
+    /// \return The maximum element count, or -1 if unlimited.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    int listMaximum() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether \p type takes a variable amount of arguments.
+    ///
+    /// \param[in] type The type to check.
+    /// \return True for Int32List, UInt64List, StringList and FileList.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    static bool isListType(ArgumentType type);
+
     ////////////////////////////////////////////////////////////////////////////
     /// Determines whether this option is optional.
     ///
@@ -119,6 +180,32 @@ public:
     ////////////////////////////////////////////////////////////////////////////
     bool isOptional() const;
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the environment variable providing the arguments of this
+    /// option if it is not given on the command line.
+    ///
+    /// \return The name of the variable, or an empty string.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QString environmentVariable() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the key providing the arguments of this option in config
+    /// files (see QArgumentConfigFile).
+    ///
+    /// \return The config key, or an empty string.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QString& configKey() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the arguments used if this option is given nowhere else.
+    ///
+    /// \return The default arguments.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QStringList& defaultArguments() const;
+
     ////////////////////////////////////////////////////////////////////////////
     /// Specifies whether this option should be optional. This property is
     /// 'false' by default.
@@ -128,6 +215,37 @@ public:
     ////////////////////////////////////////////////////////////////////////////
     void setOptional(bool optional);
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the environment variable providing the arguments of this
+    /// option. Its value is split at whitespace, honouring quotes.
+    ///
+    /// \param[in] name The name of the variable, or an empty string.
+    ///
+    /// \remarks Options without arguments are given by a variable unless its
+    ///          value is "0" or "false".
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setEnvironmentVariable(const QString& name);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the key providing the arguments of this option in config
+    /// files, e.g. "network/timeout".
+    ///
+    /// \param[in] key The config key, or an empty string.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setConfigKey(const QString& key);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Specifies the arguments used if this option is given neither on the
+    /// command line, nor by the environment or a config file. They are
+    /// validated like any other arguments.
+    ///
+    /// \param[in] arguments The default arguments.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void setDefaultArguments(const QStringList& arguments);
+
     ////////////////////////////////////////////////////////////////////////////
     /// Specifies the option identifier of this validator option.
     ///
@@ -137,26 +255,60 @@ public:
     void setOption(const QString& option);
 
     ////////////////////////////////////////////////////////////////////////////
-    /// Adds the named argument \p name with the given \p type.
+    /// Adds the named argument \p name with the given \p type. Arguments are
+    /// bound to the command line values in the order they were added.
     ///
     /// \param[in] name The name of the argument internally.
     /// \param[in] type The type of the argument.
     ///
     /// \remarks The type determines the validation method. A QDir or QFile type
     ///          for example will actually check whether a file or dir exists!
+    ///          Adding an existing name again replaces the type in place.
     ///
     ////////////////////////////////////////////////////////////////////////////
     void addArgument(const QString& name, ArgumentType type);
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// Adds the named list argument \p name, which takes between \p minimum
+    /// and \p maximum arguments of the given list \p type.
+    ///
+    /// \param[in] name The name of the argument internally.
+    /// \param[in] type The list type of the argument, e.g. Int32List.
+    /// \param[in] minimum The least amount of elements.
+    /// \param[in] maximum The greatest amount of elements, or -1 if unlimited.
+    ///
+    /// \remarks Only the first list argument of an option takes a variable
+    ///          amount of arguments; any further one takes exactly one.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void addArgument(const QString& name, ArgumentType type, int minimum, int maximum = -1);
+
 private:
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////////////////////
+    struct Argument
+    {
+        QString      name;
+        ArgumentType type;
+        int          minimum;
+        int          maximum;
+    };
+
     ////////////////////////////////////////////////////////////////////////////
     // Members
     ////////////////////////////////////////////////////////////////////////////
-    QString                     m_option;
-    QMap<QString, ArgumentType> m_arguments;
-    bool                        m_isOptional;
+    QString             m_option;
+    QVector<Argument>   m_arguments;
+    QHash<QString, int> m_argumentIndices;
+    QByteArray          m_environmentVariable;
+    QString             m_configKey;
+    QStringList         m_defaultArguments;
+    int                 m_listIndex;
+    bool                m_isOptional;
 
+    friend class QArgumentParser;
     friend class QArgumentValidator;
 };
 
@@ -178,4 +330,13 @@ private:
 /// Example: MyProgram -f /home/user/myfile.txt 100<br/>
 /// The parser will throw an error if "/home/user/myfile.txt" does not exist.
 ///
+/// Options not given on the command line may be taken from the environment,
+/// from config files or from their defaults, in this order of precedence:
+///
+/// \code
+/// option.setEnvironmentVariable("MYPROGRAM_FILE");
+/// option.setConfigKey("input/file");
+/// option.setDefaultArguments({ "default.txt", "100" });
+/// \endcode
+///
 ////////////////////////////////////////////////////////////////////////////////
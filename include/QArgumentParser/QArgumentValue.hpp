@@ -0,0 +1,240 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTVALUE_HPP
+#define QARGUMENTPARSER_QARGUMENTVALUE_HPP
+
+#include <QArgumentParser/QArgumentMappedFile.hpp>
+#include <QArgumentParser/QArgumentToken.hpp>
+#include <QArgumentParser/QArgumentValidatorOption.hpp>
+
+#include <QSharedPointer>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentValue
+/// \brief Holds one argument along with its converted, typed value.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+class QARGUMENTPARSER_API QArgumentValue
+{
+public:
+
+    QArgumentValue();
+    QArgumentValue(const QArgumentValue& other) = default;
+    QArgumentValue& operator=(const QArgumentValue& other) = default;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Initializes a new untyped value with the given \p token. Untyped values
+    /// are produced when parsing without a QArgumentValidator.
+    ///
+    /// \param[in] token The argument as it was passed on the command line.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    explicit QArgumentValue(const QArgumentToken& token);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Initializes a new value of the given non-numeric \p type.
+    ///
+    /// \param[in] token The argument as it was passed on the command line.
+    /// \param[in] type The validated type of the argument.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentValue(
+        const QArgumentToken& token,
+        QArgumentValidatorOption::ArgumentType type);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Creates a value of a signed integral \p type (Char, Int16, Int32 or
+    /// Int64) that has already been converted to \p value.
+    ///
+    /// \param[in] token The argument as it was passed on the command line.
+    /// \param[in] type The validated type of the argument.
+    /// \param[in] value The converted value.
+    /// \return The new typed value.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    static QArgumentValue fromSigned(
+        const QArgumentToken& token,
+        QArgumentValidatorOption::ArgumentType type,
+        qint64 value);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Creates a value of an unsigned integral \p type (UInt8, UInt16, UInt32
+    /// or UInt64) that has already been converted to \p value.
+    ///
+    /// \param[in] token The argument as it was passed on the command line.
+    /// \param[in] type The validated type of the argument.
+    /// \param[in] value The converted value.
+    /// \return The new typed value.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    static QArgumentValue fromUnsigned(
+        const QArgumentToken& token,
+        QArgumentValidatorOption::ArgumentType type,
+        quint64 value);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Creates a value of type MappedFile that holds the mapping of the file.
+    ///
+    /// \param[in] token The argument as it was passed on the command line.
+    /// \param[in] file The mapped file named by \p token.
+    /// \return The new typed value.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    static QArgumentValue fromMappedFile(
+        const QArgumentToken& token,
+        const QSharedPointer<const QArgumentMappedFile>& file);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Creates a value of a list \p type that holds all converted elements.
+    ///
+    /// \param[in] type The validated list type of the argument.
+    /// \param[in] elements The elements, packed contiguously: qint32 for
+    ///            Int32List, quint64 for UInt64List and QArgumentToken for
+    ///            StringList and FileList.
+    /// \return The new typed value.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    static QArgumentValue fromList(
+        QArgumentValidatorOption::ArgumentType type,
+        const QByteArray& elements);
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the validated type of this value.
+    ///
+    /// \return The type, or QArgumentValidatorOption::Invalid if untyped.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentValidatorOption::ArgumentType type() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the argument as it was passed on the command line.
+    ///
+    /// \return A view of the argument.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QArgumentToken& token() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Converts the argument as it was passed on the command line to a
+    /// QString. Each call converts the viewed characters anew, except for the
+    /// values of a QArgumentSnapshot, which share the text converted once.
+    ///
+    /// \return The argument text.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QString text() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether this value was validated against a declared type.
+    ///
+    /// \return True if typed, false if parsed without a validator.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isTyped() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether this value carries a converted integer.
+    ///
+    /// \return True for the types Char through UInt64, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isIntegral() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the converted integer, cast to \p T. The cast follows the
+    /// usual C++ integral conversion rules.
+    ///
+    /// \return The converted integer, or zero if this value is not integral.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename T> T toIntegral() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the mapping of a MappedFile argument. Copies of this value
+    /// share the mapping.
+    ///
+    /// \return The mapped file, or null for any other type.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QSharedPointer<const QArgumentMappedFile>& mappedFile() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Determines whether this value holds the elements of a list argument.
+    ///
+    /// \return True for the list types, false otherwise.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    bool isList() const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Retrieves the packed elements of a list argument.
+    ///
+    /// \return The elements, or an empty QByteArray for any other type.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    const QByteArray& listElements() const;
+
+private:
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Members
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentToken                            m_token;
+    QString                                   m_text;
+    QSharedPointer<const QArgumentMappedFile> m_mappedFile;
+    QByteArray                                m_list;
+    QArgumentValidatorOption::ArgumentType    m_type;
+    bool                                      m_isSigned;
+    union
+    {
+        qint64  m_signed;
+        quint64 m_unsigned;
+    };
+
+    friend class QArgumentParser;
+};
+
+// Inline accessors
+#include "QArgumentValue.inl"
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentValue
+///
+/// A QArgumentValue is created by the QArgumentValidator once an argument was
+/// validated successfully. Since the validator has to convert numeric types in
+/// order to validate them anyway, the converted number is stored right next to
+/// the text and QArgumentOption::argument returns it without parsing again.
+///
+/// Asking for a numeric type on a non-numeric argument (e.g. a File) yields
+/// zero. Untyped values, which are created when no validator is used, are
+/// still converted on every access.
+///
+/// Like QArgumentToken, a value views the storage the argument was read from
+/// and is only valid as long as that storage is alive.
+///
+////////////////////////////////////////////////////////////////////////////////
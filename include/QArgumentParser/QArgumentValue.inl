@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QARGUMENTPARSER_QARGUMENTVALUE_INL
+#define QARGUMENTPARSER_QARGUMENTVALUE_INL
+
+inline QArgumentValidatorOption::ArgumentType QArgumentValue::type() const
+{
+    return m_type;
+}
+
+inline const QArgumentToken& QArgumentValue::token() const
+{
+    return m_token;
+}
+
+inline QString QArgumentValue::text() const
+{
+    return m_text.isNull() ? m_token.toString() : m_text;
+}
+
+inline bool QArgumentValue::isTyped() const
+{
+    return m_type != QArgumentValidatorOption::Invalid;
+}
+
+inline bool QArgumentValue::isIntegral() const
+{
+    return m_type >= QArgumentValidatorOption::Char &&
+           m_type <= QArgumentValidatorOption::UInt64;
+}
+
+inline const QSharedPointer<const QArgumentMappedFile>& QArgumentValue::mappedFile() const
+{
+    return m_mappedFile;
+}
+
+inline bool QArgumentValue::isList() const
+{
+    return QArgumentValidatorOption::isListType(m_type);
+}
+
+inline const QByteArray& QArgumentValue::listElements() const
+{
+    return m_list;
+}
+
+template<typename T> inline T QArgumentValue::toIntegral() const
+{
+    if (!isIntegral())
+    {
+        return T();
+    }
+
+    return m_isSigned ? static_cast<T>(m_signed) : static_cast<T>(m_unsigned);
+}
+
+#endif
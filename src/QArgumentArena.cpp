@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <QArgumentParser/QArgumentArena.hpp>
+#include <QHash>
+#include <cstring>
+
+Anonymous(QARGUMENTPARSER_CONSTEXPR int c_defaultBlockSize = 16384)
+Anonymous(QARGUMENTPARSER_CONSTEXPR int c_minimumBlockSize = 256)
+Anonymous(QARGUMENTPARSER_CONSTEXPR int c_alignment = 8)
+Anonymous(QARGUMENTPARSER_CONSTEXPR int c_minimumBuckets = 64)
+Anonymous(QARGUMENTPARSER_CONSTEXPR int c_scratchSize = 256)
+
+QArgumentArena::QArgumentArena()
+    : m_blockSize(c_defaultBlockSize)
+    , m_currentBlock(0)
+    , m_used(0)
+{
+}
+
+QArgumentArena::QArgumentArena(const QArgumentArena& other)
+    : m_blocks(other.m_blocks)
+    , m_largeBlocks(other.m_largeBlocks)
+    , m_entries(other.m_entries)
+    , m_buckets(other.m_buckets)
+    , m_blockSize(other.m_blockSize)
+    , m_currentBlock(other.m_blocks.size())
+    , m_used(0)
+{
+}
+
+QArgumentArena& QArgumentArena::operator=(const QArgumentArena& other)
+{
+    // The shared blocks are never written again; see the copy constructor.
+    m_blocks = other.m_blocks;
+    m_largeBlocks = other.m_largeBlocks;
+    m_entries = other.m_entries;
+    m_buckets = other.m_buckets;
+    m_blockSize = other.m_blockSize;
+    m_currentBlock = m_blocks.size();
+    m_used = 0;
+
+    return *this;
+}
+
+int QArgumentArena::defaultBlockSize()
+{
+    return c_defaultBlockSize;
+}
+
+int QArgumentArena::blockSize() const
+{
+    return m_blockSize;
+}
+
+int QArgumentArena::blockCount() const
+{
+    return m_blocks.size() + m_largeBlocks.size();
+}
+
+qint64 QArgumentArena::capacity() const
+{
+    qint64 bytes = m_scratch.capacity();
+    for (const auto& block : m_blocks)
+    {
+        bytes += block.size();
+    }
+
+    for (const auto& block : m_largeBlocks)
+    {
+        bytes += block.size();
+    }
+
+    return bytes;
+}
+
+void QArgumentArena::setBlockSize(int size)
+{
+    m_blockSize = qMax(size, c_minimumBlockSize);
+}
+
+char* QArgumentArena::allocate(int size)
+{
+    size = (qMax(size, 1) + c_alignment - 1) & ~(c_alignment - 1);
+
+    if (size > m_blockSize)
+    {
+        m_largeBlocks.append(QByteArray(size, Qt::Uninitialized));
+        return m_largeBlocks.last().data();
+    }
+
+    // Blocks shared with a copy are skipped rather than written to.
+    while (m_currentBlock < m_blocks.size() &&
+          (m_used + size > m_blocks.at(m_currentBlock).size() ||
+          !m_blocks.at(m_currentBlock).isDetached()))
+    {
+        m_currentBlock++;
+        m_used = 0;
+    }
+
+    if (m_currentBlock == m_blocks.size())
+    {
+        m_blocks.append(QByteArray(m_blockSize, Qt::Uninitialized));
+        m_used = 0;
+    }
+
+    char* memory = m_blocks[m_currentBlock].data() + m_used;
+    m_used += size;
+
+    return memory;
+}
+
+const char* QArgumentArena::intern(const char* data, int size)
+{
+    if (m_buckets.size() < (m_entries.size() + 1) * 2)
+    {
+        rehash(qMax(c_minimumBuckets, m_buckets.size() * 2));
+    }
+
+    // Open addressing with linear probing; the bucket count is a power of two.
+    uint hash = qHashBits(data, static_cast<size_t>(size));
+    int mask = m_buckets.size() - 1;
+    int bucket = static_cast<int>(hash) & mask;
+
+    while (m_buckets.at(bucket) != -1)
+    {
+        const Entry& entry = m_entries.at(m_buckets.at(bucket));
+        if (entry.hash == hash && entry.size == size &&
+            std::memcmp(entry.data, data, static_cast<size_t>(size)) == 0)
+        {
+            return entry.data;
+        }
+
+        bucket = (bucket + 1) & mask;
+    }
+
+    char* copy = allocate(size);
+    std::memcpy(copy, data, static_cast<size_t>(size));
+
+    m_buckets[bucket] = m_entries.size();
+    m_entries.append({ copy, size, hash });
+
+    return copy;
+}
+
+QByteArray* QArgumentArena::scratch()
+{
+    // Reserved capacity survives resize(0).
+    if (m_scratch.capacity() < c_scratchSize)
+    {
+        m_scratch.reserve(c_scratchSize);
+    }
+
+    m_scratch.resize(0);
+    return &m_scratch;
+}
+
+void QArgumentArena::clear()
+{
+    // Blocks still shared with a copy are handed over to it.
+    for (int i = m_blocks.size() - 1; i >= 0; i--)
+    {
+        if (!m_blocks.at(i).isDetached())
+            m_blocks.remove(i);
+    }
+
+    m_largeBlocks.clear();
+    m_entries.clear();
+    m_buckets.fill(-1);
+    m_currentBlock = 0;
+    m_used = 0;
+}
+
+void QArgumentArena::rehash(int bucketCount)
+{
+    m_buckets.fill(-1, bucketCount);
+
+    int mask = bucketCount - 1;
+    for (int i = 0; i < m_entries.size(); i++)
+    {
+        int bucket = static_cast<int>(m_entries.at(i).hash) & mask;
+        while (m_buckets.at(bucket) != -1)
+        {
+            bucket = (bucket + 1) & mask;
+        }
+
+        m_buckets[bucket] = i;
+    }
+}
@@ -0,0 +1,194 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <QArgumentParser/QArgumentBinding.hpp>
+
+QArgumentBinding::QArgumentBinding()
+    : m_structure(nullptr)
+{
+}
+
+QArgumentBinding::QArgumentBinding(
+    const QString& option,
+    const QString& argument,
+    const void* structure,
+    const Assignment& assignment)
+    : m_option(option)
+    , m_argument(argument)
+    , m_structure(structure)
+    , m_assignment(assignment)
+{
+}
+
+const QString& QArgumentBinding::option() const
+{
+    return m_option;
+}
+
+const QString& QArgumentBinding::argument() const
+{
+    return m_argument;
+}
+
+const void* QArgumentBinding::structureKey() const
+{
+    return m_structure;
+}
+
+void QArgumentBinding::assign(void* target, const QArgumentValue& value) const
+{
+    if (m_assignment)
+    {
+        m_assignment(target, value);
+    }
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, char* member)
+{
+    *member = value.toIntegral<char>();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, uchar* member)
+{
+    *member = value.toIntegral<uchar>();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, short* member)
+{
+    *member = value.toIntegral<short>();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, ushort* member)
+{
+    *member = value.toIntegral<ushort>();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, int* member)
+{
+    *member = value.toIntegral<int>();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, uint* member)
+{
+    *member = value.toIntegral<uint>();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, qint64* member)
+{
+    *member = value.toIntegral<qint64>();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, quint64* member)
+{
+    *member = value.toIntegral<quint64>();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, QString* member)
+{
+    *member = value.text();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, QArgumentToken* member)
+{
+    *member = value.token();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, QDir* member)
+{
+    *member = QDir(value.text());
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, QByteArray* member)
+{
+    // The view of bytes() dies with the mapping, which the member outlives.
+    if (value.mappedFile().isNull())
+    {
+        *member = QByteArray();
+        return;
+    }
+
+    QByteArray bytes = value.mappedFile()->bytes();
+    *member = QByteArray(bytes.constData(), bytes.size());
+}
+
+void QArgumentBinding::convert(
+    const QArgumentValue& value,
+    QSharedPointer<const QArgumentMappedFile>* member)
+{
+    *member = value.mappedFile();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, QArgumentList<qint32>* member)
+{
+    *member = value.type() == QArgumentValidatorOption::Int32List
+        ? QArgumentList<qint32>(value.listElements())
+        : QArgumentList<qint32>();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, QArgumentList<quint64>* member)
+{
+    *member = value.type() == QArgumentValidatorOption::UInt64List
+        ? QArgumentList<quint64>(value.listElements())
+        : QArgumentList<quint64>();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, QArgumentList<QArgumentToken>* member)
+{
+    *member = value.type() == QArgumentValidatorOption::StringList ||
+              value.type() == QArgumentValidatorOption::FileList
+        ? QArgumentList<QArgumentToken>(value.listElements())
+        : QArgumentList<QArgumentToken>();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, QVector<qint32>* member)
+{
+    QArgumentList<qint32> list;
+    convert(value, &list);
+    *member = list.toVector();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, QVector<quint64>* member)
+{
+    QArgumentList<quint64> list;
+    convert(value, &list);
+    *member = list.toVector();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, QVector<QArgumentToken>* member)
+{
+    QArgumentList<QArgumentToken> list;
+    convert(value, &list);
+    *member = list.toVector();
+}
+
+void QArgumentBinding::convert(const QArgumentValue& value, QStringList* member)
+{
+    QArgumentList<QArgumentToken> list;
+    convert(value, &list);
+
+    member->clear();
+    member->reserve(list.size());
+    for (const auto& token : list)
+    {
+        member->append(token.toString());
+    }
+}
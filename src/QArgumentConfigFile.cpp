@@ -0,0 +1,483 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <QArgumentParser/QArgumentConfigFile.hpp>
+#include <QArgumentParser/QArgumentTokenizer.hpp>
+#include <QDateTime>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QSaveFile>
+#include <climits>
+#include <cstring>
+
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_23 = "Config file \"%0\" can not be read.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_24 = "Config file \"%0\" is malformed in line %1.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_25 = "Config key \"%0\" of \"%1\" has an unsupported value.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_26 = "Snapshot \"%0\" can not be written.")
+
+// Identifies snapshots; the digit is raised whenever their layout changes.
+Anonymous(QARGUMENTPARSER_CONSTEXPR char c_snapshotMagic[8] = { 'Q', 'A', 'P', 'S', 'N', 'A', 'P', '1' })
+
+Anonymous(const QString c_nullKey)
+
+////////////////////////////////////////////////////////////////////////////////
+// Reads the native-endian integers and byte ranges of a mapped snapshot.
+////////////////////////////////////////////////////////////////////////////////
+Anonymous(class SnapshotReader
+{
+public:
+
+    SnapshotReader(const char* data, qint64 size)
+        : m_data(data)
+        , m_size(size)
+        , m_position(0)
+    {
+    }
+
+    template<typename T> bool read(T* value)
+    {
+        if (m_size - m_position < static_cast<qint64>(sizeof(T)))
+            return false;
+
+        std::memcpy(value, m_data + m_position, sizeof(T));
+        m_position += sizeof(T);
+
+        return true;
+    }
+
+    bool read(qint32 size, const char** bytes)
+    {
+        if (size < 0 || m_size - m_position < size)
+            return false;
+
+        *bytes = m_data + m_position;
+        m_position += size;
+
+        return true;
+    }
+
+    bool atEnd() const
+    {
+        return m_position == m_size;
+    }
+
+private:
+
+    const char* m_data;
+    qint64      m_size;
+    qint64      m_position;
+})
+
+Anonymous(template<typename T> inline void writeRaw(QByteArray* out, T value)
+{
+    out->append(reinterpret_cast<const char*>(&value), sizeof(T));
+})
+
+Anonymous(inline bool isAsciiSpace(char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+})
+
+QArgumentConfigFile::QArgumentConfigFile()
+    : m_modified(0)
+    , m_size(0)
+    , m_isFromSnapshot(false)
+{
+}
+
+const QString& QArgumentConfigFile::path() const
+{
+    return m_path;
+}
+
+const QString& QArgumentConfigFile::errorMessage() const
+{
+    return m_errorMessage;
+}
+
+bool QArgumentConfigFile::isFromSnapshot() const
+{
+    return m_isFromSnapshot;
+}
+
+int QArgumentConfigFile::entryCount() const
+{
+    return m_entries.size();
+}
+
+int QArgumentConfigFile::indexOf(const QString& key) const
+{
+    return m_entryIndices.value(key, -1);
+}
+
+const QString& QArgumentConfigFile::keyAt(int index) const
+{
+    if (index < 0 || index >= m_entries.size())
+    {
+        return c_nullKey;
+    }
+
+    return m_entries.at(index).key;
+}
+
+int QArgumentConfigFile::argumentCount(int index) const
+{
+    if (index < 0 || index >= m_entries.size())
+    {
+        return 0;
+    }
+
+    return m_entries.at(index).count;
+}
+
+const QArgumentToken* QArgumentConfigFile::arguments(int index) const
+{
+    if (index < 0 || index >= m_entries.size())
+    {
+        return nullptr;
+    }
+
+    return m_arguments.constData() + m_entries.at(index).offset;
+}
+
+bool QArgumentConfigFile::load(
+    const QString& path,
+    Format format,
+    const QString& snapshotPath)
+{
+    clear();
+    m_path = path;
+
+    QFileInfo info(path);
+    if (!info.isFile())
+    {
+        m_errorMessage = QString(e_23).arg(path);
+        return false;
+    }
+
+    m_modified = info.lastModified().toMSecsSinceEpoch();
+    m_size = info.size();
+
+    if (!snapshotPath.isEmpty() && loadSnapshot(snapshotPath))
+    {
+        m_isFromSnapshot = true;
+        return true;
+    }
+
+    // A stale or broken snapshot leaves nothing behind.
+    clear();
+
+    QSharedPointer<const QArgumentMappedFile> file(new QArgumentMappedFile(path));
+    if (!file->isMapped() || file->size() > INT_MAX)
+    {
+        m_errorMessage = QString(e_23).arg(path);
+        return false;
+    }
+
+    m_file = file;
+
+    if (format == Auto)
+    {
+        format = path.endsWith(QLatin1String(".json"), Qt::CaseInsensitive) ? Json : Ini;
+    }
+
+    auto size = static_cast<int>(file->size());
+    return format == Json ? parseJson(file->data(), size) : parseIni(file->data(), size);
+}
+
+bool QArgumentConfigFile::saveSnapshot(const QString& path)
+{
+    QByteArray bytes;
+    bytes.append(c_snapshotMagic, sizeof(c_snapshotMagic));
+    writeRaw(&bytes, m_modified);
+    writeRaw(&bytes, m_size);
+    writeRaw(&bytes, static_cast<qint32>(m_entries.size()));
+
+    for (const auto& entry : m_entries)
+    {
+        auto key = entry.key.toUtf8();
+        writeRaw(&bytes, static_cast<qint32>(key.size()));
+        bytes.append(key);
+        writeRaw(&bytes, static_cast<qint32>(entry.count));
+
+        for (int i = 0; i < entry.count; i++)
+        {
+            const QArgumentToken& token = m_arguments.at(entry.offset + i);
+            auto utf8 = token.encoding() == QArgumentToken::Utf8
+                ? QByteArray(token.utf8(), token.size())
+                : token.toString().toUtf8();
+
+            writeRaw(&bytes, static_cast<qint32>(utf8.size()));
+            bytes.append(utf8);
+        }
+    }
+
+    // Readers never see a partially written snapshot.
+    QSaveFile file(path);
+    if (!file.open(QFile::WriteOnly) || file.write(bytes) != bytes.size() || !file.commit())
+    {
+        m_errorMessage = QString(e_26).arg(path);
+        return false;
+    }
+
+    return true;
+}
+
+void QArgumentConfigFile::clear()
+{
+    m_file.reset();
+    m_storage.clear();
+    m_arguments.clear();
+    m_entries.clear();
+    m_entryIndices.clear();
+    m_errorMessage.clear();
+    m_isFromSnapshot = false;
+}
+
+bool QArgumentConfigFile::loadSnapshot(const QString& path)
+{
+    QSharedPointer<const QArgumentMappedFile> file(new QArgumentMappedFile(path));
+    if (!file->isMapped())
+    {
+        return false;
+    }
+
+    SnapshotReader reader(file->data(), file->size());
+    const char* magic = nullptr;
+    qint64 modified = 0;
+    qint64 size = 0;
+    qint32 count = 0;
+
+    if (!reader.read(sizeof(c_snapshotMagic), &magic) ||
+        std::memcmp(magic, c_snapshotMagic, sizeof(c_snapshotMagic)) != 0 ||
+        !reader.read(&modified) || !reader.read(&size) || !reader.read(&count) ||
+        modified != m_modified || size != m_size || count < 0)
+    {
+        return false;
+    }
+
+    // The arguments view the mapping, which the entries keep alive.
+    m_file = file;
+
+    for (qint32 i = 0; i < count; i++)
+    {
+        qint32 keySize = 0;
+        qint32 argumentCount = 0;
+        const char* key = nullptr;
+
+        if (!reader.read(&keySize) || !reader.read(keySize, &key) ||
+            !reader.read(&argumentCount) || argumentCount < 0)
+        {
+            return false;
+        }
+
+        auto offset = m_arguments.size();
+        for (qint32 j = 0; j < argumentCount; j++)
+        {
+            qint32 argumentSize = 0;
+            const char* argument = nullptr;
+
+            if (!reader.read(&argumentSize) || !reader.read(argumentSize, &argument))
+                return false;
+
+            m_arguments.append(QArgumentToken::fromUtf8(argument, argumentSize));
+        }
+
+        addEntry(QString::fromUtf8(key, keySize), offset);
+    }
+
+    return reader.atEnd();
+}
+
+bool QArgumentConfigFile::parseIni(const char* data, int size)
+{
+    QArgumentTokenizer tokenizer(QArgumentTokenizer::Whitespace);
+    QArgumentToken token;
+    QString prefix;
+
+    tokenizer.setStorage(&m_storage);
+
+    int position = 0;
+    while (position < size)
+    {
+        auto newline = static_cast<const char*>(std::memchr(data + position, '\n', size - position));
+        int lineEnd = newline != nullptr ? static_cast<int>(newline - data) : size;
+        int start = position;
+        int end = lineEnd;
+
+        position = lineEnd + 1;
+
+        while (start < end && isAsciiSpace(data[start]))
+            start++;
+        while (end > start && isAsciiSpace(data[end - 1]))
+            end--;
+
+        // Blank lines and comments.
+        if (start == end || data[start] == ';' || data[start] == '#')
+        {
+            continue;
+        }
+
+        if (data[start] == '[')
+        {
+            if (data[end - 1] != ']')
+                return setMalformed(data, start);
+
+            auto section = QString::fromUtf8(data + start + 1, end - start - 2).trimmed();
+            prefix = section.isEmpty() ? QString() : section + QLatin1Char('/');
+            continue;
+        }
+
+        auto separator = static_cast<const char*>(std::memchr(data + start, '=', end - start));
+        if (separator == nullptr)
+        {
+            return setMalformed(data, start);
+        }
+
+        int keyEnd = static_cast<int>(separator - data);
+        auto key = prefix + QString::fromUtf8(data + start, keyEnd - start).trimmed();
+
+        // The value is split like a response file; plain arguments view the mapping.
+        auto offset = m_arguments.size();
+        tokenizer.setData(data + keyEnd + 1, end - keyEnd - 1);
+
+        while (tokenizer.next(&token))
+        {
+            m_arguments.append(token);
+        }
+
+        if (tokenizer.hasError())
+        {
+            return setMalformed(data, start);
+        }
+
+        addEntry(key, offset);
+    }
+
+    return true;
+}
+
+bool QArgumentConfigFile::parseJson(const char* data, int size)
+{
+    QJsonParseError error;
+    auto document = QJsonDocument::fromJson(QByteArray::fromRawData(data, size), &error);
+
+    if (error.error != QJsonParseError::NoError || !document.isObject())
+    {
+        return setMalformed(data, error.error != QJsonParseError::NoError ? error.offset : 0);
+    }
+
+    return addJsonObject(QString(), document.object());
+}
+
+bool QArgumentConfigFile::addJsonObject(const QString& prefix, const QJsonObject& object)
+{
+    for (auto it = object.begin(); it != object.end(); ++it)
+    {
+        auto key = prefix + it.key();
+        auto value = it.value();
+        auto offset = m_arguments.size();
+
+        QVector<QJsonValue> values;
+        if (value.isObject())
+        {
+            if (!addJsonObject(key + QLatin1Char('/'), value.toObject()))
+                return false;
+
+            continue;
+        }
+        else if (value.isArray())
+        {
+            for (const auto& element : value.toArray())
+                values.append(element);
+        }
+        else if (value.isBool() && value.toBool())
+        {
+            // A flag without arguments.
+        }
+        else if (value.isString() || value.isDouble())
+        {
+            values.append(value);
+        }
+        else
+        {
+            continue;
+        }
+
+        for (const auto& element : values)
+        {
+            if (element.isString())
+            {
+                m_arguments.append(keep(element.toString().toUtf8()));
+            }
+            else if (element.isDouble())
+            {
+                // Integers are written without exponent, up to 2^53.
+                auto number = element.toDouble();
+                m_arguments.append(keep(number == static_cast<double>(static_cast<qint64>(number))
+                    ? QByteArray::number(static_cast<qint64>(number))
+                    : QByteArray::number(number, 'g', 17)));
+            }
+            else if (element.isBool())
+            {
+                m_arguments.append(keep(element.toBool() ? "true" : "false"));
+            }
+            else
+            {
+                m_errorMessage = QString(e_25).arg(key, m_path);
+                return false;
+            }
+        }
+
+        addEntry(key, offset);
+    }
+
+    return true;
+}
+
+bool QArgumentConfigFile::setMalformed(const char* data, int offset)
+{
+    int line = 1;
+    for (int i = 0; i < offset; i++)
+    {
+        if (data[i] == '\n')
+            line++;
+    }
+
+    m_errorMessage = QString(e_24).arg(m_path).arg(line);
+    return false;
+}
+
+void QArgumentConfigFile::addEntry(const QString& key, int offset)
+{
+    // Later occurrences of a key replace earlier ones.
+    m_entryIndices.insert(key, m_entries.size());
+    m_entries.append({ key, offset, m_arguments.size() - offset });
+}
+
+QArgumentToken QArgumentConfigFile::keep(const QByteArray& bytes)
+{
+    m_storage.append(bytes);
+    return QArgumentToken::fromUtf8(m_storage.last().constData(), bytes.size());
+}
@@ -0,0 +1,242 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <QArgumentParser/QArgumentError.hpp>
+
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_01 = "Invalid option \"%0\".")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_02 = "Invalid argument count for option \"%0\". Expected: %1. Got %2.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_03 = "Argument at index %0 does not exist. File an issue on Github!")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_04 = "Argument \"%0\" is not of type 'char'.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_05 = "Argument \"%0\" is not of type 'unsigned char'.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_06 = "Argument \"%0\" is not of type 'short'.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_07 = "Argument \"%0\" is not of type 'unsigned short'.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_08 = "Argument \"%0\" is not of type 'int'.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_09 = "Argument \"%0\" is not of type 'unsigned int'.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_10 = "Argument \"%0\" is not of type 'long long'.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_11 = "Argument \"%0\" is not of type 'unsigned long long'.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_12 = "File at \"%0\" does not exist.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_13 = "Directory at \"%0\" does not exist.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_14 = "Missing required option \"%0\".")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_15 = "Response file \"%0\" can not be read.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_16 = "Response file \"%0\" is nested too deeply.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_17 = "Response file \"%0\" contains an unterminated quote.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_18 = "Input contains an unterminated quote.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_19 = "File at \"%0\" can not be mapped.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_20 = "Invalid argument count for list \"%0\" of option \"%1\". Expected: %2 to %3. Got %4.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_21 = "Bound option \"%0\" is unknown.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_22 = "Bound argument \"%0\" of option \"%1\" is unknown.")
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_23 = "File at \"%0\" is too large to be mapped.")
+
+// Messages of the argument type errors, indexed by code.
+Anonymous(const char* const c_typeMessages[] = { e_04, e_05, e_06, e_07, e_08, e_09, e_10, e_11 })
+
+QArgumentError::QArgumentError()
+    : QArgumentError(NoError)
+{
+}
+
+QArgumentError::QArgumentError(Code code)
+    : m_code(code)
+    , m_position(-1)
+    , m_argumentIndex(-1)
+    , m_argumentSpan(0)
+    , m_count(0)
+    , m_minimum(0)
+    , m_maximum(0)
+{
+}
+
+QArgumentError::Code QArgumentError::code() const
+{
+    return m_code;
+}
+
+const QArgumentToken& QArgumentError::option() const
+{
+    return m_option;
+}
+
+QString QArgumentError::optionName() const
+{
+    if (!m_optionName.isNull())
+    {
+        return m_optionName;
+    }
+
+    return m_option.toString();
+}
+
+const QArgumentToken& QArgumentError::argument() const
+{
+    return m_argument;
+}
+
+int QArgumentError::argumentIndex() const
+{
+    return m_argumentIndex;
+}
+
+int QArgumentError::argumentSpan() const
+{
+    return m_argumentSpan;
+}
+
+int QArgumentError::position() const
+{
+    return m_position;
+}
+
+int QArgumentError::count() const
+{
+    return m_count;
+}
+
+int QArgumentError::minimum() const
+{
+    return m_minimum;
+}
+
+int QArgumentError::maximum() const
+{
+    return m_maximum;
+}
+
+const QString& QArgumentError::detail() const
+{
+    return m_detail;
+}
+
+QString QArgumentError::message() const
+{
+    switch (m_code)
+    {
+        case NoError:
+            return QString();
+
+        case InvalidOption:
+            return QString(e_01).arg(optionName());
+
+        case InvalidArgumentCount:
+            return QString(e_02).arg(optionName(),
+                QString::number(m_minimum),
+                QString::number(m_count));
+
+        case InvalidArgumentType:
+            return QString(e_03).arg(QString::number(m_argumentIndex));
+
+        case InvalidChar:
+        case InvalidUInt8:
+        case InvalidInt16:
+        case InvalidUInt16:
+        case InvalidInt32:
+        case InvalidUInt32:
+        case InvalidInt64:
+        case InvalidUInt64:
+            return QString(c_typeMessages[m_code - InvalidChar]).arg(m_argument.toString());
+
+        case FileNotFound:
+            return QString(e_12).arg(path());
+
+        case DirectoryNotFound:
+            return QString(e_13).arg(path());
+
+        case MissingRequiredOption:
+            return QString(e_14).arg(optionName());
+
+        case ResponseFileUnreadable:
+            return QString(e_15).arg(m_argument.toString());
+
+        case ResponseFileTooDeep:
+            return QString(e_16).arg(m_argument.toString());
+
+        case ResponseFileUnterminated:
+            return QString(e_17).arg(m_argument.toString());
+
+        case UnterminatedQuote:
+            return QString(e_18);
+
+        case FileNotMappable:
+            return QString(e_19).arg(m_argument.toString());
+
+        case InvalidListCount:
+            return QString(e_20).arg(m_detail, optionName(),
+                QString::number(m_minimum),
+                m_maximum != -1 ? QString::number(m_maximum) : QString("any"),
+                QString::number(m_count));
+
+        case UnknownBoundOption:
+            return QString(e_21).arg(optionName());
+
+        case UnknownBoundArgument:
+            return QString(e_22).arg(m_detail, optionName());
+
+        case FileTooLarge:
+            return QString(e_23).arg(m_argument.toString());
+    }
+
+    return QString();
+}
+
+void QArgumentError::setCode(Code code)
+{
+    m_code = code;
+}
+
+void QArgumentError::setOption(const QArgumentToken& option)
+{
+    m_option = option;
+}
+
+void QArgumentError::setPosition(int position)
+{
+    m_position = position;
+}
+
+void QArgumentError::setOptionName(const QString& name)
+{
+    m_optionName = name;
+}
+
+void QArgumentError::setArgument(const QArgumentToken& argument, int index, int span)
+{
+    m_argument = argument;
+    m_argumentIndex = index;
+    m_argumentSpan = span;
+}
+
+void QArgumentError::setCount(int count, int minimum, int maximum)
+{
+    m_count = count;
+    m_minimum = minimum;
+    m_maximum = maximum;
+}
+
+void QArgumentError::setDetail(const QString& detail)
+{
+    m_detail = detail;
+}
+
+QString QArgumentError::path() const
+{
+    // Deferred checks keep the path they converted the argument to.
+    return m_detail.isNull() ? m_argument.toString() : m_detail;
+}
@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <QArgumentParser/QArgumentFileCache.hpp>
+#include <QArgumentParser/QArgumentStatistics.hpp>
+#include "QArgumentRunnable.hpp"
+#include <QThread>
+#include <QThreadPool>
+
+// Batches smaller than this are queried on the calling thread.
+Anonymous(QARGUMENTPARSER_CONSTEXPR int c_parallelThreshold = 8)
+
+Anonymous(const QString c_nullPath)
+
+Anonymous(const QArgumentError c_nullError)
+
+QArgumentFileCache::QArgumentFileCache()
+    : m_resolvedEntries(0)
+    , m_resolvedChecks(0)
+    , m_maxThreadCount(QThread::idealThreadCount())
+{
+}
+
+int QArgumentFileCache::maxThreadCount() const
+{
+    return m_maxThreadCount;
+}
+
+int QArgumentFileCache::checkCount() const
+{
+    return m_checks.size();
+}
+
+const QString& QArgumentFileCache::checkPath(int index) const
+{
+    if (index < 0 || index >= m_checks.size())
+    {
+        return c_nullPath;
+    }
+
+    return m_entries.at(m_checks.at(index).entry).path;
+}
+
+QArgumentValidatorOption::ArgumentType QArgumentFileCache::checkType(int index) const
+{
+    if (index < 0 || index >= m_checks.size())
+    {
+        return QArgumentValidatorOption::Invalid;
+    }
+
+    return m_checks.at(index).type;
+}
+
+const QArgumentError& QArgumentFileCache::checkError(int index) const
+{
+    if (index < 0 || index >= m_checks.size())
+    {
+        return c_nullError;
+    }
+
+    return m_checks.at(index).error;
+}
+
+QFileInfo QArgumentFileCache::info(const QString& path) const
+{
+    auto index = m_entryIndices.value(path, -1);
+    if (index == -1 || index >= m_resolvedEntries)
+    {
+        return QFileInfo(path);
+    }
+
+    return m_entries.at(index).info;
+}
+
+void QArgumentFileCache::setMaxThreadCount(int count)
+{
+    m_maxThreadCount = qMax(count, 1);
+}
+
+void QArgumentFileCache::addCheck(
+    const QString& path,
+    QArgumentValidatorOption::ArgumentType type,
+    const QArgumentError& error)
+{
+    auto index = m_entryIndices.value(path, -1);
+    if (index == -1)
+    {
+        index = m_entries.size();
+        m_entryIndices.insert(path, index);
+        m_entries.append({ path, QFileInfo(), false, false });
+    }
+
+    m_checks.append({ index, type, error });
+}
+
+int QArgumentFileCache::resolve()
+{
+    auto begin = m_resolvedEntries;
+    auto end = m_entries.size();
+    auto threads = qMin(m_maxThreadCount, end - begin);
+
+    QARGUMENTPARSER_STATISTICS(QArgumentStatistics::record(QArgumentStatistics::FileProbes, end - begin));
+
+    if (end - begin >= c_parallelThreshold && threads > 1)
+    {
+        // Detaches once up front; the workers write to distinct entries.
+        Entry* entries = m_entries.data();
+        QAtomicInt next(begin);
+        QThreadPool pool;
+
+        pool.setMaxThreadCount(threads);
+        for (int i = 0; i < threads; i++)
+        {
+            pool.start(new QArgumentRunnable(&next, end, [entries](int index)
+            {
+                query(entries + index);
+            }));
+        }
+
+        pool.waitForDone();
+    }
+    else
+    {
+        for (int i = begin; i < end; i++)
+        {
+            query(&m_entries[i]);
+        }
+    }
+
+    m_resolvedEntries = end;
+
+    // Verifies in the order of addition, so the reported failure does not
+    // depend on which thread finished first.
+    while (m_resolvedChecks < m_checks.size())
+    {
+        auto index = m_resolvedChecks++;
+        const Check& check = m_checks.at(index);
+        const Entry& entry = m_entries.at(check.entry);
+
+        if (check.type == QArgumentValidatorOption::Directory ? !entry.isDir : !entry.exists)
+        {
+            return index;
+        }
+    }
+
+    return -1;
+}
+
+void QArgumentFileCache::clear()
+{
+    m_entries.clear();
+    m_entryIndices.clear();
+    m_checks.clear();
+    m_resolvedEntries = 0;
+    m_resolvedChecks = 0;
+}
+
+void QArgumentFileCache::query(Entry* entry)
+{
+    entry->info = QFileInfo(entry->path);
+    entry->exists = entry->info.exists();
+    entry->isDir = entry->exists && entry->info.isDir();
+}
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <QArgumentParser/QArgumentMappedFile.hpp>
+#include <climits>
+
+QArgumentMappedFile::QArgumentMappedFile(const QString& path)
+    : m_file(path)
+    , m_data(nullptr)
+    , m_size(0)
+    , m_isMapped(false)
+{
+    // Created by validating threads, released by whichever thread drops the
+    // last reference; the file never processes events, so it has no thread.
+    m_file.moveToThread(nullptr);
+
+    if (!m_file.open(QFile::ReadOnly))
+    {
+        return;
+    }
+
+    // Mapping zero bytes fails on some platforms; there is nothing to view.
+    m_size = m_file.size();
+    if (m_size > 0)
+    {
+        m_data = reinterpret_cast<const char*>(m_file.map(0, m_size));
+        if (m_data == nullptr)
+        {
+            m_size = 0;
+            return;
+        }
+    }
+
+    m_isMapped = true;
+}
+
+QString QArgumentMappedFile::fileName() const
+{
+    return m_file.fileName();
+}
+
+bool QArgumentMappedFile::isMapped() const
+{
+    return m_isMapped;
+}
+
+const char* QArgumentMappedFile::data() const
+{
+    return m_data;
+}
+
+qint64 QArgumentMappedFile::size() const
+{
+    return m_size;
+}
+
+QByteArray QArgumentMappedFile::bytes() const
+{
+    if (!m_isMapped)
+    {
+        return QByteArray();
+    }
+
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    // Qt 5 byte arrays are limited to INT_MAX bytes.
+    if (m_size > INT_MAX)
+    {
+        return QByteArray();
+    }
+
+    return QByteArray::fromRawData(m_data, static_cast<int>(m_size));
+#else
+    return QByteArray::fromRawData(m_data, m_size);
+#endif
+}
@@ -22,12 +22,12 @@
 
 #include <QArgumentParser/QArgumentOption.hpp>
 
-QArgumentOption::~QArgumentOption()
+Anonymous(const QArgumentValue c_nullValue)
+
+QArgumentOption::QArgumentOption()
+    : m_argumentOffset(0)
+    , m_argumentCount(0)
 {
-    for (auto* handle : m_fileHandles)
-    {
-        delete handle;
-    }
 }
 
 const QString& QArgumentOption::option() const
@@ -40,7 +40,36 @@ void QArgumentOption::setOption(const QString& option)
     m_option = option;
 }
 
-void QArgumentOption::addArgument(const QString& arg, const QString& value)
+void QArgumentOption::setSchema(const QArgumentValidatorOption& schema)
+{
+    m_schema = schema;
+}
+
+void QArgumentOption::setArguments(const QArgumentStorage* storage, int offset, int count)
+{
+    m_storage = QExplicitlySharedDataPointer<const QArgumentStorage>(storage);
+    m_argumentOffset = offset;
+    m_argumentCount = count;
+}
+
+const QArgumentValue& QArgumentOption::valueOf(int index) const
 {
-    m_arguments.insert(arg, value);
+    if (index < 0 || index >= m_argumentCount)
+    {
+        return c_nullValue;
+    }
+
+    return m_storage->valueAt(m_argumentOffset + index);
+}
+
+QFile* QArgumentOption::fileHandle(int index) const
+{
+    // Options that were not parsed have no storage to own the handle.
+    if (!m_storage || index < 0 || index >= m_argumentCount)
+    {
+        return nullptr;
+    }
+
+    // The options of a parse share the handles; the last one releases them.
+    return m_storage->fileHandle(m_argumentOffset + index);
 }
@@ -21,151 +21,1965 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <QArgumentParser/QArgumentParser.hpp>
+#include "QArgumentRunnable.hpp"
+#include <QDir>
+#include <QFileInfo>
+#include <QIODevice>
+#include <QThread>
+#include <QThreadPool>
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+
+// Response files may include other response files up to this depth.
+Anonymous(QARGUMENTPARSER_CONSTEXPR int c_maxResponseDepth = 16)
+
+// Setting this environment variable enables statistics and prints them.
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto c_statisticsVariable = "QARGUMENTPARSER_STATISTICS")
+
+// Streamed input is read in chunks of this size.
+Anonymous(QARGUMENTPARSER_CONSTEXPR int c_streamChunkSize = 65536)
+
+// Fewer segments than this are validated on the calling thread.
+Anonymous(QARGUMENTPARSER_CONSTEXPR int c_parallelSegments = 1024)
+
+// Segments are validated in blocks of this size, the unit of work of a thread.
+Anonymous(QARGUMENTPARSER_CONSTEXPR int c_segmentBlockSize = 256)
+
+Anonymous(const QArgumentError c_noError)
+Anonymous(const QString c_noSubcommand)
+Anonymous(QARGUMENTPARSER_CONSTEXPR auto c_completeOption = "--complete")
+
+namespace
+{
+    ////////////////////////////////////////////////////////////////////////////
+    // Collects the path checks and the first failure of one block.
+    ////////////////////////////////////////////////////////////////////////////
+    struct SegmentBlock
+    {
+        QArgumentFileCache      files;
+        QVector<QArgumentError> errors;
+        int                     failed = -1;
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// One option and its arguments, split off the input before validation.
+////////////////////////////////////////////////////////////////////////////////
+struct QArgumentParser::Segment
+{
+    QArgumentToken          option;
+    QVector<QArgumentToken> args;
+    QVector<QArgumentValue> values;
+    int                     index;
+    int                     position;
+    bool                    isValid;
+};
 
 QArgumentParser::QArgumentParser(int argc, char* argv[])
-    : m_optionIndicator("-")
+    : m_argumentsUtf8(nullptr)
+    , m_argumentsUtf16(nullptr)
+    , m_argumentCount(0)
+    , m_commentCharacter('\0')
+    , m_validator(new QArgumentValidator)
+    , m_mainValidator(m_validator)
+    , m_subcommand(-1)
+    , m_subcommandEnd(0)
+    , m_currentPosition(-1)
+    , m_tokenCount(0)
+    , m_optionIndicator("-")
+    , m_helpOption("h")
+    , m_boundTarget(nullptr)
+    , m_segments(nullptr)
+    , m_pathCheckThreadCount(QThread::idealThreadCount())
+    , m_parseThreadCount(1)
+    , m_batchThreadCount(QThread::idealThreadCount())
+    , m_arenaBlockSize(QArgumentArena::defaultBlockSize())
+    , m_responseFileMode(QArgumentTokenizer::Whitespace)
+    , m_isResponseFileEnabled(false)
+    , m_isArenaEnabled(false)
+    , m_isErrorCollectionEnabled(false)
+    , m_isAbbreviationEnabled(false)
+    , m_isCompletionEnabled(false)
+    , m_isEnvironmentEnabled(true)
+    , m_isStatisticsEnabled(qEnvironmentVariableIsSet(c_statisticsVariable))
+    , m_isStatisticsPrinted(m_isStatisticsEnabled)
+{
+    if (argc > 0)
+    {
+        m_firstArgument = QString(argv[0]);
+
+        // Ignores the first argument. The others are viewed, not copied.
+        m_argumentsUtf8 = argv + 1;
+        m_argumentCount = argc - 1;
+    }
+}
+
+const QString& QArgumentParser::firstArgument() const
+{
+    return m_firstArgument;
+}
+
+const QArgumentOption QArgumentParser::option(const QString& name) const
+{
+    return findOption(name);
+}
+
+QArgumentOptionView QArgumentParser::optionView(const QString& name) const
+{
+    return QArgumentOptionView(findOption(name));
+}
+
+int QArgumentParser::optionCount() const
+{
+    return m_options.size();
+}
+
+QArgumentOptionView::Iterator QArgumentParser::begin() const
+{
+    return QArgumentOptionView::Iterator(m_options.constData());
+}
+
+QArgumentOptionView::Iterator QArgumentParser::end() const
+{
+    return QArgumentOptionView::Iterator(m_options.constData() + m_options.size());
+}
+
+std::shared_ptr<const QArgumentSnapshot> QArgumentParser::snapshot() const
+{
+    std::shared_ptr<QArgumentSnapshot> snapshot(new QArgumentSnapshot);
+    snapshot->m_validator = m_validator;
+    snapshot->m_options = m_options;
+    snapshot->m_optionSlots = m_optionSlots;
+    snapshot->m_firstArgument = m_firstArgument;
+
+    if (m_storage.data() == nullptr)
+    {
+        return snapshot;
+    }
+
+    // The values and the elements of string lists view argv, response files
+    // or the arena of this parser. Values view the text they keep from now
+    // on; list elements are pointed to copies owned by the snapshot. Both
+    // buffers are sized up front, so that they never move while the tokens
+    // are pointed into them.
+    QExplicitlySharedDataPointer<QArgumentStorage> storage(new QArgumentStorage);
+    storage->m_values = m_storage->m_values;
+    storage->m_files = m_storage->m_files;
+
+    int utf8Size = 0;
+    int utf16Size = 0;
+
+    auto measureToken = [&](const QArgumentToken& token)
+    {
+        if (token.encoding() == QArgumentToken::Utf8)
+            utf8Size += token.size() + 1;
+        else
+            utf16Size += token.size();
+    };
+
+    // StringList and FileList values pack their tokens into the list bytes.
+    auto listTokens = [](const QArgumentValue& value, int* count) -> const QArgumentToken*
+    {
+        auto type = value.m_type;
+        if (type != QArgumentValidatorOption::StringList && type != QArgumentValidatorOption::FileList)
+        {
+            *count = 0;
+            return nullptr;
+        }
+
+        *count = value.m_list.size() / static_cast<int>(sizeof(QArgumentToken));
+        return reinterpret_cast<const QArgumentToken*>(value.m_list.constData());
+    };
+
+    for (const auto& value : storage->m_values)
+    {
+        int count = 0;
+        auto tokens = listTokens(value, &count);
+
+        for (int i = 0; i < count; i++)
+        {
+            measureToken(tokens[i]);
+        }
+    }
+
+    snapshot->m_utf8 = QByteArray(utf8Size, '\0');
+    snapshot->m_utf16.resize(utf16Size);
+
+    char* utf8 = snapshot->m_utf8.data();
+    QChar* utf16 = snapshot->m_utf16.data();
+
+    auto copyToken = [&](const QArgumentToken& token)
+    {
+        if (token.encoding() == QArgumentToken::Utf8)
+        {
+            std::copy(token.utf8(), token.utf8() + token.size(), utf8);
+            auto copy = QArgumentToken::fromUtf8(utf8, token.size());
+            utf8 += token.size() + 1;
+
+            return copy;
+        }
+
+        QStringView text = token.utf16();
+        std::copy(text.begin(), text.end(), utf16);
+        auto copy = QArgumentToken::fromUtf16(QStringView(utf16, token.size()));
+        utf16 += token.size();
+
+        return copy;
+    };
+
+    for (auto& value : storage->m_values)
+    {
+        int count = 0;
+        auto tokens = listTokens(value, &count);
+
+        // Readers share the text instead of converting it on every read.
+        value.m_text = value.m_token.toString();
+        value.m_token = QArgumentToken::fromUtf16(QStringView(value.m_text));
+        if (count > 0)
+        {
+            // Rebuilt rather than detached, so the parser's list is untouched.
+            QByteArray elements(value.m_list.size(), Qt::Uninitialized);
+            auto copies = reinterpret_cast<QArgumentToken*>(elements.data());
+
+            for (int i = 0; i < count; i++)
+            {
+                copies[i] = copyToken(tokens[i]);
+            }
+
+            value.m_list = elements;
+        }
+    }
+
+    storage->createFileHandles();
+    for (auto& option : snapshot->m_options)
+    {
+        option.setArguments(storage.data(), option.m_argumentOffset, option.m_argumentCount);
+    }
+
+    return snapshot;
+}
+
+const QArgumentOption& QArgumentParser::findOption(const QString& name) const
+{
+    if (m_validator->optionCount() > 0)
+    {
+        auto index = m_validator->indexOf(name);
+        if (index == -1 || index >= m_optionSlots.size() || m_optionSlots.at(index) < 0)
+        {
+            return m_defaultOption;
+        }
+
+        return m_options.at(m_optionSlots.at(index));
+    }
+
+    // Without a validator, options are not indexed; there are few of them.
+    for (const auto& option : m_options)
+    {
+        if (option.option() == name)
+        {
+            return option;
+        }
+    }
+
+    return m_defaultOption;
+}
+
+const QArgumentValidator& QArgumentParser::validator() const
+{
+    return *m_validator;
+}
+
+const QString& QArgumentParser::subcommand() const
+{
+    if (m_subcommand == -1)
+    {
+        return c_noSubcommand;
+    }
+
+    return m_subcommands.at(m_subcommand).name;
+}
+
+int QArgumentParser::subcommandCount() const
+{
+    return m_subcommands.size();
+}
+
+const QString& QArgumentParser::optionIndicator() const
+{
+    return m_optionIndicator;
+}
+
+const QString& QArgumentParser::helpOption() const
+{
+    return m_helpOption;
+}
+
+const QArgumentError& QArgumentParser::error() const
+{
+    if (m_errors.isEmpty())
+    {
+        return c_noError;
+    }
+
+    return m_errors.first();
+}
+
+const QVector<QArgumentError>& QArgumentParser::errors() const
+{
+    return m_errors;
+}
+
+const QString& QArgumentParser::errorMessage() const
+{
+    // Formatted once per failure, on request.
+    if (m_errorMessage.isNull() && !m_errors.isEmpty())
+    {
+        for (int i = 0; i < m_errors.size(); i++)
+        {
+            if (i > 0)
+                m_errorMessage.append(QLatin1Char('\n'));
+
+            m_errorMessage.append(m_errors.at(i).message());
+        }
+    }
+
+    return m_errorMessage;
+}
+
+bool QArgumentParser::isErrorCollectionEnabled() const
+{
+    return m_isErrorCollectionEnabled;
+}
+
+bool QArgumentParser::isAbbreviationEnabled() const
+{
+    return m_isAbbreviationEnabled;
+}
+
+bool QArgumentParser::isCompletionEnabled() const
+{
+    return m_isCompletionEnabled;
+}
+
+const QStringList& QArgumentParser::completions() const
+{
+    return m_completions;
+}
+
+bool QArgumentParser::isResponseFileEnabled() const
+{
+    return m_isResponseFileEnabled;
+}
+
+QArgumentTokenizer::Mode QArgumentParser::responseFileMode() const
+{
+    return m_responseFileMode;
+}
+
+int QArgumentParser::pathCheckThreadCount() const
+{
+    return m_pathCheckThreadCount;
+}
+
+int QArgumentParser::parseThreadCount() const
+{
+    return m_parseThreadCount;
+}
+
+int QArgumentParser::batchThreadCount() const
+{
+    return m_batchThreadCount;
+}
+
+bool QArgumentParser::isArenaEnabled() const
+{
+    return m_isArenaEnabled;
+}
+
+int QArgumentParser::arenaBlockSize() const
+{
+    return m_arenaBlockSize;
+}
+
+bool QArgumentParser::isStatisticsEnabled() const
+{
+    return m_isStatisticsEnabled;
+}
+
+const QArgumentStatistics& QArgumentParser::statistics() const
+{
+    return m_statistics;
+}
+
+void QArgumentParser::setValidator(const QArgumentValidator& validator)
+{
+    QSharedPointer<QArgumentValidator> compiled(new QArgumentValidator(validator));
+    compiled->compile();
+
+    m_validator = compiled;
+    m_mainValidator = compiled;
+}
+
+void QArgumentParser::setValidator(const QSharedPointer<const QArgumentValidator>& validator)
+{
+    // The shared validator must not be modified; compiles a copy instead.
+    if (validator.isNull())
+        setValidator(QArgumentValidator());
+    else if (!validator->isCompiled())
+        setValidator(*validator);
+    else
+        m_validator = m_mainValidator = validator;
+}
+
+void QArgumentParser::addSubcommand(
+    const QString& name,
+    const std::function<void(QArgumentValidator*)>& factory)
+{
+    // Kept sorted by name, so that the first argument is found by bisection.
+    auto it = std::lower_bound(m_subcommands.begin(), m_subcommands.end(), name,
+        [](const Subcommand& subcommand, const QString& other)
+        {
+            return subcommand.name < other;
+        });
+
+    if (it != m_subcommands.end() && it->name == name)
+    {
+        *it = { name, factory, QSharedPointer<const QArgumentValidator>() };
+    }
+    else
+    {
+        auto index = static_cast<int>(it - m_subcommands.begin());
+        m_subcommands.insert(index, { name, factory, QSharedPointer<const QArgumentValidator>() });
+    }
+
+    m_subcommand = -1;
+    m_validator = m_mainValidator;
+}
+
+void QArgumentParser::clearSubcommands()
+{
+    m_subcommands.clear();
+    m_subcommand = -1;
+    m_validator = m_mainValidator;
+}
+
+void QArgumentParser::setOptionIndicator(const QString& indicator)
+{
+    if (indicator.isEmpty())
+        m_optionIndicator = "-";
+    else
+        m_optionIndicator = indicator;
+}
+
+void QArgumentParser::setHelpOption(const QString& option)
+{
+    m_helpOption = option;
+}
+
+void QArgumentParser::setResponseFileEnabled(bool enabled)
+{
+    m_isResponseFileEnabled = enabled;
+}
+
+void QArgumentParser::setResponseFileMode(QArgumentTokenizer::Mode mode)
+{
+    m_responseFileMode = mode;
+}
+
+void QArgumentParser::setPathCheckThreadCount(int count)
+{
+    m_pathCheckThreadCount = qMax(count, 1);
+}
+
+void QArgumentParser::setParseThreadCount(int count)
+{
+    m_parseThreadCount = qMax(count, 1);
+}
+
+void QArgumentParser::setBatchThreadCount(int count)
+{
+    m_batchThreadCount = qMax(count, 1);
+}
+
+void QArgumentParser::setArenaEnabled(bool enabled)
+{
+    m_isArenaEnabled = enabled;
+}
+
+void QArgumentParser::setErrorCollectionEnabled(bool enabled)
+{
+    m_isErrorCollectionEnabled = enabled;
+}
+
+void QArgumentParser::setAbbreviationEnabled(bool enabled)
+{
+    m_isAbbreviationEnabled = enabled;
+}
+
+void QArgumentParser::setCompletionEnabled(bool enabled)
+{
+    m_isCompletionEnabled = enabled;
+}
+
+void QArgumentParser::setArenaBlockSize(int size)
+{
+    m_arenaBlockSize = size;
+}
+
+void QArgumentParser::setStatisticsEnabled(bool enabled)
+{
+    m_isStatisticsEnabled = enabled;
+}
+
+void QArgumentParser::addConfigFile(const QArgumentConfigFile& file)
+{
+    m_configFiles.append(file);
+}
+
+void QArgumentParser::clearConfigFiles()
+{
+    m_configFiles.clear();
+}
+
+void QArgumentParser::clearBindings()
+{
+    m_bindings.clear();
+}
+
+QArgumentParser::ResultType QArgumentParser::parse()
 {
-    m_firstArgument = QString(argv[0]);
+    ResultType result;
+    {
+        QArgumentStatistics::Scope scope(collectedStatistics());
+        result = parseArguments();
+    }
+
+    // Deferred path checks and missing options are reported last; collected
+    // errors are put back into input order, with the latter at the end.
+    if (m_errors.size() > 1)
+    {
+        std::stable_sort(m_errors.begin(), m_errors.end(),
+            [](const QArgumentError& a, const QArgumentError& b)
+            {
+                auto positionA = static_cast<uint>(a.position());
+                auto positionB = static_cast<uint>(b.position());
+
+                return positionA != positionB
+                    ? positionA < positionB
+                    : a.argumentIndex() < b.argumentIndex();
+            });
+    }
+
+    finishStatistics();
+    return result;
+}
+
+void QArgumentParser::reset()
+{
+    // Clearing keeps the capacity of the containers.
+    m_options.clear();
+    m_optionSlots.fill(-1, m_validator->optionCount());
+    m_currentOption = QArgumentToken();
+    m_currentPosition = -1;
+    m_tokenCount = 0;
+    m_currentArgs.clear();
+    m_errors.clear();
+    m_errorMessage.clear();
+    m_completions.clear();
+}
+
+QArgumentParser::ResultType QArgumentParser::parseBound(const void* structure, void* target)
+{
+    // Bindings refer to the options of the chosen subcommand.
+    selectSubcommand(0);
+    if (!resolveBindings(structure))
+    {
+        return Failure;
+    }
+
+    m_boundTarget = target;
+    auto result = parse();
+    m_boundTarget = nullptr;
+
+    return result;
+}
+
+QArgumentParser::ResultType QArgumentParser::parseArguments()
+{
+    if (m_isCompletionEnabled && m_argumentCount > 0 &&
+        tokenAt(0).equals(QLatin1String(c_completeOption)))
+    {
+        return complete();
+    }
+
+    selectSubcommand(0);
+    reset();
+
+    // We could potentially get errors when having zero arguments. Other
+    // sources may provide all options, though.
+    bool hasArguments = m_argumentCount > 0 || !m_commandLine.isNull();
+    if (!hasArguments && !hasSources())
+    {
+        return HelpRequested;
+    }
+
+    prepareStorage();
+
+    // With several threads, the input is split into options first, which
+    // are then validated concurrently; see commitSegments().
+    QVector<Segment> segments;
+    if (m_parseThreadCount > 1 && m_validator->optionCount() > 0)
+    {
+        m_segments = &segments;
+    }
+
+    // The name of the subcommand counts as a token, but is no option.
+    auto first = 0;
+    if (m_subcommand != -1)
+    {
+        first = m_argumentCount > 0 ? m_subcommandEnd : 0;
+        m_tokenCount = 1;
+    }
+
+    // Builds the option <> argument tree.
+    auto result = Success;
+    if (!m_commandLine.isNull())
+    {
+        result = consumeCommandLine();
+    }
+
+    for (int i = first; i < m_argumentCount && result == Success; i++)
+    {
+        result = consumeArgument(tokenAt(i).trimmed(), 0);
+    }
+
+    // Validates the last remaining option.
+    bool hasOptions = m_tokenCount > (m_subcommand != -1 ? 1 : 0);
+    if (result == Success && hasArguments && hasOptions && !endOption())
+    {
+        result = Failure;
+    }
+
+    // Options split off before a failure or help request precede it, so
+    // their errors take precedence.
+    if (m_segments != nullptr)
+    {
+        m_segments = nullptr;
+        if (!commitSegments(&segments) && !m_isErrorCollectionEnabled)
+        {
+            return failPaths();
+        }
+    }
+
+    // Collected errors precede a help request, as they would without.
+    if (result == HelpRequested && !m_errors.isEmpty())
+    {
+        result = Failure;
+    }
+
+    if (result != Success)
+    {
+        return result == Failure ? failPaths() : result;
+    }
+
+    // Fills in the options not given on the command line.
+    if (!consumeSources())
+    {
+        return failPaths();
+    }
+
+    // Checks all File and Directory arguments at once.
+    if (!validatePaths() && !m_isErrorCollectionEnabled)
+    {
+        return Failure;
+    }
+
+    // Required options must be provided.
+    if (isMissingRequired())
+    {
+        return Failure;
+    }
+
+    return m_errors.isEmpty() ? Success : Failure;
+}
+
+QArgumentParser::ResultType QArgumentParser::parse(
+    const char* const* arguments,
+    int count)
+{
+    m_argumentsUtf8 = arguments;
+    m_argumentsUtf16 = nullptr;
+    m_argumentCount = count;
+    m_commandLine = QStringView();
+
+    return parse();
+}
+
+QArgumentParser::ResultType QArgumentParser::parse(
+    const QStringView* arguments,
+    int count)
+{
+    m_argumentsUtf8 = nullptr;
+    m_argumentsUtf16 = arguments;
+    m_argumentCount = count;
+    m_commandLine = QStringView();
+
+    return parse();
+}
+
+QArgumentParser::ResultType QArgumentParser::parse(QStringView commandLine, char comment)
+{
+    // An empty view must still be told apart from having no command line.
+    m_argumentsUtf8 = nullptr;
+    m_argumentsUtf16 = nullptr;
+    m_argumentCount = 0;
+    m_commandLine = commandLine.isNull() ? QStringView(u"", 0) : commandLine;
+    m_commentCharacter = comment;
+
+    return parse();
+}
+
+QArgumentParser::ResultType QArgumentParser::parse(
+    QIODevice* device,
+    const std::function<void(const QArgumentOption&)>& callback,
+    QArgumentTokenizer::Mode mode)
+{
+    ResultType result;
+    {
+        QArgumentStatistics::Scope scope(collectedStatistics());
+        result = parseStream(device, callback, mode);
+    }
+
+    finishStatistics();
+    return result;
+}
+
+QArgumentParser::ResultType QArgumentParser::parseStream(
+    QIODevice* device,
+    const std::function<void(const QArgumentOption&)>& callback,
+    QArgumentTokenizer::Mode mode)
+{
+    m_validator = m_mainValidator;
+    m_subcommand = -1;
+    reset();
+    prepareStorage();
+
+    QArgumentTokenizer tokenizer(mode);
+    QArgumentToken token;
+    QByteArray buffer;
+    QByteArray pool;
+    QVector<int> offsets;
+    int position = -1;
+    int tokenCount = 0;
+    bool hasTokens = false;
+    bool isFinal = false;
+
+    // The pool holds the name and arguments of the pending option, each
+    // ending at the respective offset. Reserved capacity survives resize(0).
+    pool.reserve(c_streamChunkSize);
+    offsets << 0 << 0;
+    tokenizer.setStorage(&m_storage->m_tokenStorage);
+
+    while (!isFinal)
+    {
+        auto offset = buffer.size();
+        buffer.resize(offset + c_streamChunkSize);
+
+        auto read = device->read(buffer.data() + offset, c_streamChunkSize);
+        buffer.resize(offset + static_cast<int>(qMax<qint64>(read, 0)));
+
+        // Sequential devices report zero bytes while waiting for the writer.
+        if (read == 0 && device->waitForReadyRead(-1))
+        {
+            continue;
+        }
+
+        isFinal = read <= 0;
+        tokenizer.setData(buffer.constData(), buffer.size(), isFinal);
+
+        while (tokenizer.next(&token))
+        {
+            auto current = token.trimmed();
+            auto indicator = current.prefixLength(m_optionIndicator);
+            hasTokens = true;
+            tokenCount++;
+
+            QARGUMENTPARSER_STATISTICS(QArgumentStatistics::record(QArgumentStatistics::Tokens));
+
+            if (indicator != -1)
+            {
+                current = current.mid(indicator);
+                if (isHelpOption(current))
+                {
+                    return HelpRequested;
+                }
+
+                // Arguments preceding the first option are dropped, as in parse().
+                if (offsets.at(1) > 0 && !streamOption(pool, offsets, position, callback))
+                {
+                    return Failure;
+                }
+
+                position = tokenCount - 1;
+                pool.resize(0);
+                offsets.resize(1);
+                pool.append(current.utf8(), current.size());
+                offsets.append(pool.size());
+            }
+            else if (!current.isEmpty())
+            {
+                pool.append(current.utf8(), current.size());
+                offsets.append(pool.size());
+            }
+        }
+
+        // Everything consumed has been copied to the pool by now.
+        m_storage->m_tokenStorage.clear();
+        buffer.remove(0, tokenizer.position());
+    }
+
+    // The buffer viewed by the last token has been consumed already.
+    if (tokenizer.hasError())
+    {
+        return fail(QArgumentError::UnterminatedQuote, QArgumentToken(), tokenCount - 1);
+    }
+
+    // We could potentially get errors when having zero arguments.
+    if (!hasTokens)
+    {
+        return HelpRequested;
+    }
+
+    // Validates the last remaining option.
+    if (!streamOption(pool, offsets, position, callback))
+    {
+        return Failure;
+    }
+
+    // Required options must have been provided somewhere in the stream.
+    if (isMissingRequired())
+    {
+        return Failure;
+    }
+
+    return Success;
+}
+
+QVector<QArgumentParser::ResultType> QArgumentParser::validateBatch(
+    const QVector<QStringList>& argumentLists,
+    QVector<QVector<QArgumentError>>* errors) const
+{
+    auto count = argumentLists.size();
+    auto threads = qMin(m_batchThreadCount, count);
+
+    // The subcommands named by the vectors are built here, on the calling
+    // thread, and cached; the workers only share their validators.
+    for (int i = 0; i < count && !m_subcommands.isEmpty(); i++)
+    {
+        const QStringList& arguments = argumentLists.at(i);
+        if (arguments.isEmpty())
+            continue;
+
+        auto index = findSubcommand(QArgumentToken::fromUtf16(arguments.first()).trimmed());
+        if (index != -1)
+            buildSubcommand(index);
+    }
+
+    // Detaches once up front; the workers write to distinct elements.
+    QVector<ResultType> results(count, Failure);
+    ResultType* resultData = results.data();
+    QVector<QArgumentError>* errorData = nullptr;
+
+    if (errors != nullptr)
+    {
+        errors->fill(QVector<QArgumentError>(), count);
+        errorData = errors->data();
+    }
+
+    // Every thread has a parser of its own; only the compiled validator,
+    // which is never modified, and the input are shared.
+    auto makeWork = [&]()
+    {
+        QSharedPointer<QArgumentParser> worker(new QArgumentParser(0, nullptr));
+        worker->m_validator = m_validator;
+        worker->m_mainValidator = m_mainValidator;
+        worker->m_subcommands = m_subcommands;
+        worker->m_optionIndicator = m_optionIndicator;
+        worker->m_helpOption = m_helpOption;
+        worker->m_pathCheckThreadCount = 1;
+        worker->m_isErrorCollectionEnabled = m_isErrorCollectionEnabled;
+        worker->m_isAbbreviationEnabled = m_isAbbreviationEnabled;
+        worker->m_isEnvironmentEnabled = false;
+        worker->m_isStatisticsEnabled = false;
+        worker->m_isStatisticsPrinted = false;
+
+        QSharedPointer<QVector<QStringView>> views(new QVector<QStringView>);
+        return [worker, views, &argumentLists, resultData, errorData](int index)
+        {
+            const QStringList& arguments = argumentLists.at(index);
+
+            views->resize(0);
+            for (const auto& argument : arguments)
+            {
+                views->append(QStringView(argument));
+            }
+
+            resultData[index] = worker->parse(views->constData(), views->size());
+            if (errorData != nullptr)
+            {
+                errorData[index] = worker->m_errors;
+            }
+        };
+    };
+
+    if (threads > 1)
+    {
+        QAtomicInt next(0);
+        QThreadPool pool;
+
+        pool.setMaxThreadCount(threads);
+        for (int i = 0; i < threads; i++)
+        {
+            pool.start(new QArgumentRunnable(&next, count, makeWork()));
+        }
+
+        pool.waitForDone();
+    }
+    else
+    {
+        auto work = makeWork();
+        for (int i = 0; i < count; i++)
+        {
+            work(i);
+        }
+    }
+
+    return results;
+}
+
+void QArgumentParser::selectSubcommand(int first)
+{
+    m_validator = m_mainValidator;
+    m_subcommand = -1;
+    m_subcommandEnd = 0;
+
+    if (m_subcommands.isEmpty())
+    {
+        return;
+    }
+
+    // The first token names the subcommand. Of a command line, it is split
+    // off here; the remainder is tokenized as usual afterwards.
+    QArgumentTokenizer tokenizer(QArgumentTokenizer::Shell);
+    QArgumentToken name;
+    int end = 0;
+
+    if (m_argumentCount > first)
+    {
+        name = tokenAt(first).trimmed();
+        end = first + 1;
+    }
+    else if (first == 0 && !m_commandLine.isNull())
+    {
+        tokenizer.setCommentCharacter(m_commentCharacter);
+        tokenizer.setData(m_commandLine);
+
+        if (!tokenizer.next(&name) || tokenizer.hasError())
+            return;
+
+        end = tokenizer.position();
+    }
+
+    auto index = findSubcommand(name);
+    if (index == -1)
+    {
+        return;
+    }
+
+    m_validator = buildSubcommand(index);
+    m_subcommand = index;
+    m_subcommandEnd = end;
+}
+
+int QArgumentParser::findSubcommand(const QArgumentToken& name) const
+{
+    auto begin = m_subcommands.constBegin();
+    auto end = m_subcommands.constEnd();
+
+    auto it = std::lower_bound(begin, end, name,
+        [](const Subcommand& subcommand, const QArgumentToken& other)
+        {
+            return other.compare(subcommand.name) > 0;
+        });
+
+    if (name.isEmpty() || it == end || name.compare(it->name) != 0)
+    {
+        return -1;
+    }
+
+    return static_cast<int>(it - begin);
+}
+
+const QSharedPointer<const QArgumentValidator>& QArgumentParser::buildSubcommand(int index) const
+{
+    // Only the chosen subcommand builds its validator, once.
+    const Subcommand& subcommand = m_subcommands.at(index);
+    if (subcommand.validator.isNull())
+    {
+        QSharedPointer<QArgumentValidator> validator(new QArgumentValidator);
+        subcommand.factory(validator.data());
+        validator->compile();
+
+        m_subcommands[index].validator = validator;
+    }
+
+    return m_subcommands.at(index).validator;
+}
+
+QArgumentParser::ResultType QArgumentParser::complete()
+{
+    // The arguments following "--complete" are the words typed so far; the
+    // last one is being completed. A subcommand needs a word after it.
+    auto partialIndex = m_argumentCount - 1;
+    selectSubcommand(partialIndex > 1 ? 1 : m_argumentCount);
+    reset();
+
+    auto first = m_subcommand != -1 ? m_subcommandEnd : 1;
+    auto partial = partialIndex > 0 ? tokenAt(partialIndex).trimmed() : QArgumentToken();
+
+    // Options are completed by their names, which share the indicator.
+    auto indicator = partial.prefixLength(m_optionIndicator);
+    if (indicator != -1)
+    {
+        for (int index : m_validator->optionsWithPrefix(partial.mid(indicator)))
+        {
+            m_completions.append(m_optionIndicator + m_validator->optionAt(index).option());
+        }
+
+        return CompletionRequested;
+    }
+
+    // Otherwise, the word is an argument of the last option, if any.
+    for (int i = partialIndex - 1; i >= first; i--)
+    {
+        auto token = tokenAt(i).trimmed();
+        auto length = token.prefixLength(m_optionIndicator);
+        if (length == -1)
+        {
+            continue;
+        }
+
+        auto name = token.mid(length);
+        auto index = m_isAbbreviationEnabled
+            ? m_validator->indexOfAbbreviation(name)
+            : m_validator->indexOf(name);
+
+        const QArgumentValidatorOption& schema = m_validator->optionAt(index);
+        auto argument = partialIndex - i - 1;
+        auto count = schema.argumentCount();
+        auto type = QArgumentValidatorOption::Invalid;
+
+        // List arguments take all remaining words.
+        if (argument < count)
+            type = schema.argumentType(argument);
+        else if (count > 0 && QArgumentValidatorOption::isListType(schema.argumentType(count - 1)))
+            type = schema.argumentType(count - 1);
+
+        if (type == QArgumentValidatorOption::File ||
+            type == QArgumentValidatorOption::MappedFile ||
+            type == QArgumentValidatorOption::FileList)
+        {
+            completePaths(partial.toString(), false);
+        }
+        else if (type == QArgumentValidatorOption::Directory)
+        {
+            completePaths(partial.toString(), true);
+        }
+
+        return CompletionRequested;
+    }
+
+    // The first word may name a subcommand.
+    if (m_subcommand == -1 && partialIndex <= 1)
+    {
+        for (const auto& subcommand : m_subcommands)
+        {
+            if (partial.isPrefixOf(subcommand.name))
+            {
+                m_completions.append(subcommand.name);
+            }
+        }
+    }
+
+    return CompletionRequested;
+}
+
+void QArgumentParser::completePaths(const QString& partial, bool isDirectory)
+{
+    // Lists the directory of 'partial' and keeps the entries starting with
+    // its file name part; directories end with a slash to continue with.
+    auto slash = partial.lastIndexOf(QLatin1Char('/'));
+    auto directory = partial.left(slash + 1);
+    auto name = partial.mid(slash + 1);
+
+    QDir::Filters filters = QDir::Dirs | QDir::NoDotAndDotDot;
+    if (!isDirectory)
+        filters |= QDir::Files;
+    if (name.startsWith(QLatin1Char('.')))
+        filters |= QDir::Hidden;
+
+    QDir dir(directory.isEmpty() ? QStringLiteral(".") : directory);
+    for (const QFileInfo& info : dir.entryInfoList(filters, QDir::Name))
+    {
+        auto entry = info.fileName();
+        if (entry.startsWith(name))
+        {
+            m_completions.append(directory + entry + (info.isDir() ? QStringLiteral("/") : QString()));
+        }
+    }
+}
+
+QArgumentToken QArgumentParser::tokenAt(int index) const
+{
+    if (m_argumentsUtf16 != nullptr)
+    {
+        return QArgumentToken::fromUtf16(m_argumentsUtf16[index]);
+    }
+
+    return QArgumentToken::fromUtf8(m_argumentsUtf8[index]);
+}
+
+QArgumentParser::ResultType QArgumentParser::consumeCommandLine()
+{
+    QArgumentTokenizer tokenizer(QArgumentTokenizer::Shell);
+    QArgumentToken token;
+
+    // Tokens are consumed as they are found.
+    prepareTokenizer(&tokenizer);
+    tokenizer.setCommentCharacter(m_commentCharacter);
+    tokenizer.setData(m_subcommand != -1 ? m_commandLine.mid(m_subcommandEnd) : m_commandLine);
+
+    bool isEmpty = m_subcommand == -1;
+    while (tokenizer.next(&token))
+    {
+        isEmpty = false;
+
+        auto result = consumeArgument(token.trimmed(), 0);
+        if (result != Success)
+        {
+            return result;
+        }
+    }
+
+    if (tokenizer.hasError())
+    {
+        return fail(QArgumentError::UnterminatedQuote, token, m_tokenCount - 1);
+    }
+
+    // Like zero arguments, a blank command line requests help.
+    return isEmpty ? HelpRequested : Success;
+}
+
+bool QArgumentParser::consumeSources()
+{
+    // The environment takes precedence over config files, and those over the
+    // defaults. Options are read from the highest layer providing them only,
+    // so that each of them is validated once.
+    for (int i = 0; i < m_optionSlots.size(); i++)
+    {
+        if (m_optionSlots.at(i) != -1)
+        {
+            continue;
+        }
+
+        const QArgumentValidatorOption& schema = m_validator->optionAt(i);
+        m_currentArgs.clear();
+
+        if (!readEnvironment(schema) && !readConfigFiles(schema) && !readDefaults(schema))
+        {
+            continue;
+        }
+
+        // Options without arguments are switched off by "0" or "false".
+        if (schema.argumentCount() == 0 && m_currentArgs.size() == 1)
+        {
+            const QArgumentToken& value = m_currentArgs.first();
+            if (value.equals(QLatin1String("0")) || value.equals(QLatin1String("false")))
+                continue;
+
+            m_currentArgs.clear();
+        }
+
+        auto name = QArgumentToken::fromUtf16(schema.option());
+        if (!commitOption(name, -1, m_currentArgs, &m_currentValues))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool QArgumentParser::readEnvironment(const QArgumentValidatorOption& schema)
+{
+    if (!m_isEnvironmentEnabled || schema.m_environmentVariable.isEmpty() ||
+       !qEnvironmentVariableIsSet(schema.m_environmentVariable.constData()))
+    {
+        return false;
+    }
+
+    // The value is kept along with unescaped tokens and split like those.
+    auto value = qgetenv(schema.m_environmentVariable.constData());
+    const char* data = value.constData();
+
+    if (m_isArenaEnabled)
+    {
+        data = m_storage->m_arena.intern(data, value.size());
+    }
+    else
+    {
+        m_storage->m_tokenStorage.append(value);
+    }
+
+    QArgumentTokenizer tokenizer(QArgumentTokenizer::Whitespace);
+    QArgumentToken token;
+
+    prepareTokenizer(&tokenizer);
+    tokenizer.setData(data, value.size());
+
+    // Empty tokens, e.g. of FOO="''", are dropped like on the command line.
+    while (tokenizer.next(&token))
+    {
+        if (!token.isEmpty())
+            m_currentArgs.append(token);
+    }
+
+    return true;
+}
+
+bool QArgumentParser::readConfigFiles(const QArgumentValidatorOption& schema)
+{
+    if (schema.configKey().isEmpty())
+    {
+        return false;
+    }
+
+    for (int i = m_configFiles.size() - 1; i >= 0; i--)
+    {
+        const QArgumentConfigFile& file = m_configFiles.at(i);
+        auto index = file.indexOf(schema.configKey());
+
+        if (index != -1)
+        {
+            auto arguments = file.arguments(index);
+            for (int j = 0; j < file.argumentCount(index); j++)
+            {
+                if (!arguments[j].isEmpty())
+                    m_currentArgs.append(arguments[j]);
+            }
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool QArgumentParser::readDefaults(const QArgumentValidatorOption& schema)
+{
+    // The options keep a copy of their schema, which shares the strings.
+    const QStringList& defaults = schema.defaultArguments();
+    for (const auto& argument : defaults)
+    {
+        if (!argument.isEmpty())
+            m_currentArgs.append(QArgumentToken::fromUtf16(argument));
+    }
+
+    return !defaults.isEmpty();
+}
+
+bool QArgumentParser::hasSources() const
+{
+    if (!m_configFiles.isEmpty())
+    {
+        return true;
+    }
+
+    for (int i = 0; i < m_validator->optionCount(); i++)
+    {
+        const QArgumentValidatorOption& schema = m_validator->optionAt(i);
+        if ((m_isEnvironmentEnabled && !schema.m_environmentVariable.isEmpty()) ||
+            !schema.defaultArguments().isEmpty())
+            return true;
+    }
+
+    return false;
+}
 
-    // Ignores the first argument.
-    for (int i = 1; i < argc; i++)
+void QArgumentParser::prepareTokenizer(QArgumentTokenizer* tokenizer)
+{
+    // Unescaped tokens are kept in the token storage or the arena of the
+    // results, as long as those are alive.
+    if (m_isArenaEnabled)
+    {
+        tokenizer->setArena(&m_storage->m_arena);
+    }
+    else
     {
-        m_arguments.append(QString(argv[i]));
+        tokenizer->setStorage(&m_storage->m_tokenStorage);
     }
 }
 
-const QString& QArgumentParser::firstArgument() const
+QArgumentParser::ResultType QArgumentParser::consumeArgument(
+    const QArgumentToken& token,
+    int depth)
 {
-    return m_firstArgument;
+    QARGUMENTPARSER_STATISTICS(QArgumentStatistics::record(QArgumentStatistics::Tokens));
+    m_tokenCount++;
+
+    if (m_isResponseFileEnabled && !token.isEmpty() && token.unitAt(0) == '@')
+    {
+        return consumeResponseFile(token.mid(1), depth);
+    }
+
+    return consumeToken(token);
 }
 
-const QArgumentOption QArgumentParser::option(const QString& name) const
+bool QArgumentParser::isHelpOption(const QArgumentToken& option) const
 {
-    return m_options.value(name, m_defaultOption);
+    return !m_helpOption.isEmpty() && option.compare(m_helpOption) == 0;
 }
 
-const QArgumentValidator& QArgumentParser::validator() const
+QArgumentParser::ResultType QArgumentParser::consumeToken(const QArgumentToken& token)
 {
-    return m_validator;
+    auto current = token;
+    auto indicator = current.prefixLength(m_optionIndicator);
+    if (indicator != -1)
+    {
+        current = current.mid(indicator);
+
+        if (isHelpOption(current))
+        {
+            return HelpRequested;
+        }
+
+        // Current option changed, validate and add the old option.
+        // Warning: Without a validator, this will always succeed!
+        if (!m_currentOption.isEmpty())
+        {
+            if (!endOption())
+                return Failure;
+        }
+
+        m_currentOption = current;
+        m_currentPosition = m_tokenCount - 1;
+        m_currentArgs.clear();
+    }
+    else if (!current.isEmpty())
+    {
+        m_currentArgs.append(current);
+    }
+
+    return Success;
 }
 
-const QString& QArgumentParser::optionIndicator() const
+QArgumentParser::ResultType QArgumentParser::consumeResponseFile(
+    const QArgumentToken& path,
+    int depth)
 {
-    return m_optionIndicator;
+    // The '@path' argument was counted just before.
+    auto position = m_tokenCount - 1;
+    if (depth >= c_maxResponseDepth)
+    {
+        return fail(QArgumentError::ResponseFileTooDeep, path, position);
+    }
+
+    QARGUMENTPARSER_STATISTICS(QArgumentStatistics::record(QArgumentStatistics::FileProbes));
+
+    // The file is mapped rather than read; the tokens view the mapping, which
+    // stays alive as long as the results.
+    QSharedPointer<QFile> file(new QFile(path.toString()));
+    if (!file->open(QFile::ReadOnly) || file->size() > INT_MAX)
+    {
+        return fail(QArgumentError::ResponseFileUnreadable, path, position);
+    }
+
+    const char* data = nullptr;
+    int size = static_cast<int>(file->size());
+    if (size > 0)
+    {
+        data = reinterpret_cast<const char*>(file->map(0, size));
+        if (data == nullptr)
+        {
+            return fail(QArgumentError::ResponseFileUnreadable, path, position);
+        }
+    }
+
+    m_storage->m_responseFiles.append(file);
+
+    QArgumentTokenizer tokenizer(m_responseFileMode);
+    QArgumentToken token;
+
+    prepareTokenizer(&tokenizer);
+    tokenizer.setData(data, size);
+
+    while (tokenizer.next(&token))
+    {
+        auto result = consumeArgument(token.trimmed(), depth + 1);
+        if (result != Success)
+        {
+            return result;
+        }
+    }
+
+    if (tokenizer.hasError())
+    {
+        return fail(QArgumentError::ResponseFileUnterminated, path, position);
+    }
+
+    return Success;
 }
 
-const QString& QArgumentParser::errorMessage() const
+bool QArgumentParser::commitOption(
+    const QArgumentToken& opt,
+    int position,
+    const QVector<QArgumentToken>& args,
+    QVector<QArgumentValue>* values)
 {
-    return m_errorMessage;
+    int index = -1;
+    if (!validateOption(opt, position, args, values, &m_storage->m_files, &index, &m_errors))
+    {
+        // Collected invalid options count as given, but are not kept.
+        if (m_isErrorCollectionEnabled && index != -1)
+        {
+            m_optionSlots[index] = -2;
+        }
+
+        return m_isErrorCollectionEnabled;
+    }
+
+    QARGUMENTPARSER_STATISTICS(QArgumentStatistics::record(QArgumentStatistics::Options));
+
+    // Bound options are written to the target instead of being kept.
+    if (bindOption(index, *values))
+    {
+        return true;
+    }
+
+    insertOption(index, makeOption(index, opt, args, *values));
+
+    return true;
 }
 
-void QArgumentParser::setValidator(const QArgumentValidator& validator)
+bool QArgumentParser::endOption()
 {
-    m_validator = validator;
+    if (m_segments == nullptr)
+    {
+        return commitOption(m_currentOption, m_currentPosition, m_currentArgs, &m_currentValues);
+    }
+
+    m_segments->append({ m_currentOption, std::move(m_currentArgs), QVector<QArgumentValue>(), -1,
+                         m_currentPosition, true });
+    m_currentArgs.clear();
+
+    return true;
 }
 
-void QArgumentParser::setOptionIndicator(const QString& indicator)
+bool QArgumentParser::commitSegments(QVector<Segment>* segments)
 {
-    if (indicator.isEmpty())
-        m_optionIndicator = "-";
+    auto count = segments->size();
+    auto blockCount = (count + c_segmentBlockSize - 1) / c_segmentBlockSize;
+    auto threads = qMin(m_parseThreadCount, blockCount);
+
+    // Detaches once up front; the workers write to distinct elements.
+    QVector<SegmentBlock> blocks(blockCount);
+    SegmentBlock* blockData = blocks.data();
+    Segment* segmentData = segments->data();
+    QAtomicInt firstFailure(blockCount);
+
+    auto validateBlock = [&](int block)
+    {
+        // Blocks behind a failed one are never merged.
+        if (block > firstFailure.loadAcquire())
+        {
+            return;
+        }
+
+        auto end = qMin((block + 1) * c_segmentBlockSize, count);
+        for (int i = block * c_segmentBlockSize; i < end; i++)
+        {
+            Segment& segment = segmentData[i];
+            segment.isValid = validateOption(
+                segment.option,
+                segment.position,
+                segment.args,
+                &segment.values,
+                &blockData[block].files,
+                &segment.index,
+                &blockData[block].errors);
+
+            // Collecting errors validates every block completely.
+            if (!segment.isValid && !m_isErrorCollectionEnabled)
+            {
+                blockData[block].failed = i;
+
+                auto current = firstFailure.loadAcquire();
+                while (block < current && !firstFailure.testAndSetOrdered(current, block))
+                {
+                    current = firstFailure.loadAcquire();
+                }
+
+                return;
+            }
+        }
+    };
+
+    if (count >= c_parallelSegments && threads > 1)
+    {
+        QArgumentStatistics::PhaseTimer timer(QArgumentStatistics::Validation);
+        QAtomicInt next(0);
+        QThreadPool pool;
+
+        pool.setMaxThreadCount(threads);
+        for (int i = 0; i < threads; i++)
+        {
+            pool.start(new QArgumentRunnable(&next, blockCount, validateBlock));
+        }
+
+        pool.waitForDone();
+    }
     else
-        m_optionIndicator = indicator;
+    {
+        for (int i = 0; i < blockCount && firstFailure.loadAcquire() == blockCount; i++)
+        {
+            validateBlock(i);
+        }
+    }
+
+    // Merges in input order, up to and including the first failure, which is
+    // exactly what the sequential path would have committed and checked.
+    for (int i = 0; i < blockCount; i++)
+    {
+        const SegmentBlock& block = blocks.at(i);
+        for (int j = 0; j < block.files.checkCount(); j++)
+        {
+            m_storage->m_files.addCheck(
+                block.files.checkPath(j), block.files.checkType(j), block.files.checkError(j));
+        }
+
+        auto end = block.failed != -1 ? block.failed : qMin((i + 1) * c_segmentBlockSize, count);
+        for (int j = i * c_segmentBlockSize; j < end; j++)
+        {
+            const Segment& segment = segments->at(j);
+            if (!segment.isValid)
+            {
+                if (segment.index != -1)
+                    m_optionSlots[segment.index] = -2;
+
+                continue;
+            }
+
+            QARGUMENTPARSER_STATISTICS(QArgumentStatistics::record(QArgumentStatistics::Options));
+
+            if (!bindOption(segment.index, segment.values))
+            {
+                insertOption(segment.index, makeOption(
+                    segment.index, segment.option, segment.args, segment.values));
+            }
+        }
+
+        m_errors += block.errors;
+        if (block.failed != -1)
+        {
+            return false;
+        }
+    }
+
+    return m_errors.isEmpty();
 }
 
-QArgumentParser::ResultType QArgumentParser::parse()
+bool QArgumentParser::validateOption(
+    const QArgumentToken& opt,
+    int position,
+    const QVector<QArgumentToken>& args,
+    QVector<QArgumentValue>* values,
+    QArgumentFileCache* files,
+    int* index,
+    QVector<QArgumentError>* errors) const
 {
-    // We could potentially get errors when having zero arguments.
-    if (m_arguments.size() == 0)
+    *index = -1;
+    values->clear();
+
+    if (m_validator->optionCount() > 0)
     {
-        return HelpRequested;
+        {
+            QArgumentStatistics::PhaseTimer timer(QArgumentStatistics::Lookup);
+            *index = m_isAbbreviationEnabled
+                ? m_validator->indexOfAbbreviation(opt)
+                : m_validator->indexOf(opt);
+        }
+
+        QArgumentStatistics::PhaseTimer timer(QArgumentStatistics::Validation);
+
+        // Every error of the option refers to its token in the input.
+        QArgumentError origin;
+        origin.setOption(opt);
+        origin.setPosition(position);
+
+        if (*index == -1)
+        {
+            origin.setCode(QArgumentError::InvalidOption);
+            errors->append(origin);
+            return false;
+        }
+
+        if (m_isErrorCollectionEnabled)
+        {
+            return m_validator->validate(*index, args, origin, nullptr, errors, values, files);
+        }
+
+        QArgumentError error;
+        if (!m_validator->validate(*index, args, origin, &error, nullptr, values, files))
+        {
+            errors->append(error);
+            return false;
+        }
     }
 
-    bool mustValidate = m_validator.optionCount() > 0;
+    return true;
+}
 
-    QString currentOption;
-    QVector<QString> currentArgs;
+QArgumentOption QArgumentParser::makeOption(
+    int index,
+    const QArgumentToken& opt,
+    const QVector<QArgumentToken>& args,
+    const QVector<QArgumentValue>& values)
+{
+    QArgumentOption option;
 
-    // Builds the option <> argument tree.
-    for (int i = 0; i < m_arguments.size(); i++)
+    // Without a validator, index is -1 and optionAt() returns an invalid
+    // option without any named arguments; arguments remain accessible by index.
+    const QArgumentValidatorOption& schema = m_validator->optionAt(index);
+    option.setOption(index != -1 ? schema.option() : opt.toString());
+    option.setSchema(schema);
+
+    // Without a validator, there are no converted values to take over. With
+    // one, there is a value per declared argument; lists take several args.
+    QVector<QArgumentValue>& storage = m_storage->m_values;
+    auto offset = storage.size();
+    if (index != -1)
+    {
+        storage += values;
+    }
+    else
+    {
+        for (int i = 0; i < args.size(); i++)
+        {
+            storage.append(QArgumentValue(args.at(i)));
+        }
+    }
+
+    option.setArguments(m_storage.data(), offset, storage.size() - offset);
+    return option;
+}
+
+void QArgumentParser::insertOption(int index, const QArgumentOption& option)
+{
+    // Options given more than once replace their earlier occurrence.
+    int slot = -1;
+    if (index != -1)
     {
-        auto current = m_arguments.at(i).trimmed();
-        if (current.startsWith(m_optionIndicator))
+        slot = m_optionSlots.at(index);
+    }
+    else
+    {
+        for (int i = 0; i < m_options.size() && slot == -1; i++)
         {
-            current = current.mid(m_optionIndicator.size());
+            if (m_options.at(i).option() == option.option())
+                slot = i;
+        }
+    }
+
+    if (slot >= 0)
+    {
+        m_options[slot] = option;
+        return;
+    }
+
+    if (index != -1)
+    {
+        m_optionSlots[index] = m_options.size();
+    }
+
+    m_options.append(option);
+}
+
+bool QArgumentParser::resolveBindings(const void* structure)
+{
+    m_boundBindings.clear();
+    m_boundArguments.clear();
+    m_boundOffsets.fill(0, m_validator->optionCount() + 1);
+
+    QVector<int> options, arguments;
+    options.reserve(m_bindings.size());
+    arguments.reserve(m_bindings.size());
 
-            // TODO: Variable help identifier?
-            if (current == "h")
+    // Resolves the names once; parsing only deals with indices.
+    for (const auto& binding : m_bindings)
+    {
+        int index = -1, argument = -1;
+        if (binding.structureKey() == structure)
+        {
+            index = m_validator->indexOf(binding.option());
+            if (index == -1)
             {
-                return HelpRequested;
+                QArgumentError error(QArgumentError::UnknownBoundOption);
+                error.setOptionName(binding.option());
+                m_errors.append(error);
+                return false;
             }
 
-            // Current option changed, validate the old option.
-            if (!currentOption.isEmpty())
+            // A null argument name binds the presence of the option.
+            if (!binding.argument().isNull())
             {
-                if (mustValidate)
+                argument = m_validator->optionAt(index).argumentIndex(binding.argument());
+                if (argument == -1)
                 {
-                    if (!m_validator.validate(currentOption, currentArgs, &m_errorMessage))
-                        return Failure;
+                    QArgumentError error(QArgumentError::UnknownBoundArgument);
+                    error.setOptionName(binding.option());
+                    error.setDetail(binding.argument());
+                    m_errors.append(error);
+                    return false;
                 }
-
-                // Now that the validation is complete, we can add the option.
-                // Warning: Without a validator, this will always be the case!
-                insertOption(currentOption, currentArgs);
             }
 
-            currentOption = current;
-            currentArgs.clear();
+            m_boundOffsets[index + 1]++;
         }
-        else if (!current.isEmpty())
+
+        options.append(index);
+        arguments.append(argument);
+    }
+
+    // Orders the bindings by option; those of option i are found in the
+    // range [m_boundOffsets[i], m_boundOffsets[i + 1]).
+    for (int i = 0; i < m_validator->optionCount(); i++)
+    {
+        m_boundOffsets[i + 1] += m_boundOffsets.at(i);
+    }
+
+    QVector<int> cursors = m_boundOffsets;
+    m_boundBindings.resize(m_boundOffsets.last());
+    m_boundArguments.resize(m_boundOffsets.last());
+
+    for (int i = 0; i < options.size(); i++)
+    {
+        if (options.at(i) != -1)
         {
-            currentArgs.append(current);
+            int position = cursors[options.at(i)]++;
+            m_boundBindings[position] = i;
+            m_boundArguments[position] = arguments.at(i);
         }
     }
 
-    // Validates the last remaining option.
-    if (mustValidate)
+    return true;
+}
+
+bool QArgumentParser::bindOption(int index, const QVector<QArgumentValue>& values)
+{
+    if (m_boundTarget == nullptr || index == -1)
     {
-        if (!m_validator.validate(currentOption, currentArgs, &m_errorMessage))
-            return Failure;
+        return false;
     }
 
-    insertOption(currentOption, currentArgs);
+    int begin = m_boundOffsets.at(index);
+    int end = m_boundOffsets.at(index + 1);
+    if (begin == end)
+    {
+        return false;
+    }
 
-    // Required options must be provided.
-    if (isMissingRequired(&m_errorMessage))
+    for (int i = begin; i < end; i++)
     {
-        return Failure;
+        int argument = m_boundArguments.at(i);
+        m_bindings.at(m_boundBindings.at(i)).assign(
+            m_boundTarget,
+            argument != -1 ? values.at(argument) : QArgumentValue());
     }
 
-    return Success;
+    // Marks the option as given without keeping it.
+    m_optionSlots[index] = -2;
+    return true;
 }
 
-void QArgumentParser::insertOption(const QString& opt, const QVector<QString>& args)
+bool QArgumentParser::streamOption(
+    const QByteArray& pool,
+    const QVector<int>& offsets,
+    int position,
+    const std::function<void(const QArgumentOption&)>& callback)
 {
-    QArgumentOption option;
+    auto name = QArgumentToken::fromUtf8(pool.constData(), offsets.at(1));
+
+    m_currentArgs.clear();
+    for (int i = 2; i < offsets.size(); i++)
+    {
+        m_currentArgs.append(QArgumentToken::fromUtf8(
+            pool.constData() + offsets.at(i - 1),
+            offsets.at(i) - offsets.at(i - 1)));
+    }
+
+    // Streamed arguments do not outlive the option, so paths are checked now.
+    int index = -1;
+    if (!validateOption(name, position, m_currentArgs, &m_currentValues, nullptr, &index, &m_errors))
+    {
+        // The error views the pool, which is kept alive with it.
+        m_storage->m_tokenStorage.append(pool);
+        return false;
+    }
+
+    QARGUMENTPARSER_STATISTICS(QArgumentStatistics::record(QArgumentStatistics::Options));
+
+    // Streamed options are not retained; the slot only records their presence.
+    if (index != -1)
+    {
+        m_optionSlots[index] = -2;
+    }
+
+    // Each streamed option starts over, so the storage does not grow.
+    prepareStorage();
+    callback(makeOption(index, name, m_currentArgs, m_currentValues));
+    return true;
+}
+
+void QArgumentParser::prepareStorage()
+{
+    // Options of earlier parses that are still alive keep their storage;
+    // otherwise, it is cleared and reused along with its capacity.
+    if (m_storage.data() == nullptr || m_storage->isShared())
+    {
+        m_storage = QExplicitlySharedDataPointer<QArgumentStorage>(new QArgumentStorage);
+    }
+    else
+    {
+        m_storage->clear();
+    }
+
+    m_storage->m_files.setMaxThreadCount(m_pathCheckThreadCount);
+    m_storage->m_arena.setBlockSize(m_arenaBlockSize);
+}
+
+QArgumentParser::ResultType QArgumentParser::failPaths()
+{
+    // Deferred path checks precede the failure in argument order; a failing
+    // one of them is what a sequential validation would have reported.
+    validatePaths();
+    return Failure;
+}
+
+bool QArgumentParser::validatePaths()
+{
+    QArgumentStatistics::PhaseTimer timer(QArgumentStatistics::PathCheck);
+
+    if (m_isErrorCollectionEnabled)
+    {
+        return m_validator->validatePaths(&m_storage->m_files, &m_errors);
+    }
 
-    for (int i = 0; i < args.size(); i++)
+    // A failing path precedes any other error that might have been recorded.
+    QArgumentError error;
+    if (!m_validator->validatePaths(&m_storage->m_files, &error))
     {
-        // If the validator is invalid, option() will return an invalid option
-        // and invalid options by default have null identifiers. Therefore we
-        // do not have to check whether the validator is valid first.
-        option.addArgument(m_validator.option(opt).argumentName(i), args.at(i));
+        m_errors.clear();
+        m_errors.append(error);
+        return false;
     }
 
-    m_options.insert(opt, option);
+    return true;
 }
 
-bool QArgumentParser::isMissingRequired(QString* msg)
+bool QArgumentParser::isMissingRequired()
 {
-    for (int i = 0; i < m_validator.optionCount(); i++)
+    QArgumentStatistics::PhaseTimer timer(QArgumentStatistics::RequiredCheck);
+
+    auto isMissing = false;
+    for (int index : m_validator->requiredOptions())
     {
-        auto opt = m_validator.optionAt(i);
-        if (!opt.isOptional() && !m_options.contains(opt.option()))
+        if (m_optionSlots.at(index) == -1)
         {
-            *msg = QString("Missing required option \"%0\".").arg(opt.option());
-            return true;
+            QArgumentError error(QArgumentError::MissingRequiredOption);
+            error.setOptionName(m_validator->optionAt(index).option());
+            m_errors.append(error);
+            isMissing = true;
+
+            if (!m_isErrorCollectionEnabled)
+                break;
         }
     }
 
-    return false;
+    return isMissing;
+}
+
+QArgumentParser::ResultType QArgumentParser::fail(
+    QArgumentError::Code code,
+    const QArgumentToken& argument,
+    int position)
+{
+    QArgumentError error(code);
+    error.setArgument(argument);
+    error.setPosition(position);
+    m_errors.append(error);
+
+    return Failure;
+}
+
+QArgumentStatistics* QArgumentParser::collectedStatistics()
+{
+#if defined(QARGUMENTPARSER_NO_STATISTICS)
+    return nullptr;
+#else
+    return m_isStatisticsEnabled ? &m_statistics : nullptr;
+#endif
+}
+
+void QArgumentParser::finishStatistics()
+{
+    if (collectedStatistics() == nullptr)
+    {
+        return;
+    }
+
+    // Estimates the heap memory owned by the result; implicitly shared data,
+    // like the schema of each option, is counted once by the validator.
+    qint64 bytes = m_options.capacity() * sizeof(QArgumentOption)
+        + m_optionSlots.capacity() * sizeof(int)
+        + m_errors.capacity() * sizeof(QArgumentError);
+
+    for (const auto& option : m_options)
+    {
+        bytes += option.m_option.capacity() * sizeof(QChar);
+    }
+
+    if (m_storage.data() != nullptr)
+    {
+        bytes += m_storage->m_values.capacity() * sizeof(QArgumentValue);
+
+        for (const auto& value : m_storage->m_values)
+        {
+            bytes += value.listElements().capacity();
+        }
+
+        bytes += m_storage->m_arena.capacity();
+
+        for (const auto& storage : m_storage->m_tokenStorage)
+        {
+            bytes += storage.capacity();
+        }
+    }
+
+    m_statistics.m_retainedBytes = bytes;
+
+    if (m_isStatisticsPrinted)
+    {
+        std::fprintf(stderr, "%s\n", m_statistics.toJson().constData());
+    }
 }
@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+#ifndef QARGUMENTPARSER_QARGUMENTRUNNABLE_HPP
+#define QARGUMENTPARSER_QARGUMENTRUNNABLE_HPP
+
+#include <QAtomicInt>
+#include <QRunnable>
+#include <functional>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentRunnable
+/// \brief Runs work for indices taken from a shared counter on a thread pool.
+/// \author QArgumentParser contributors
+/// \date October 17, 2026
+///
+////////////////////////////////////////////////////////////////////////////////
+class QArgumentRunnable : public QRunnable
+{
+public:
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Creates a runnable that calls 'work' for every index taken from 'next'.
+    ///
+    /// \param[in] next Counter shared by all runnables of one batch.
+    /// \param[in] end Index at which the runnable stops.
+    /// \param[in] work Function called with each taken index.
+    ///
+    /// \remarks 'next' must outlive the runnable.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    QArgumentRunnable(QAtomicInt* next, int end, const std::function<void(int)>& work)
+        : m_next(next)
+        , m_end(end)
+        , m_work(work)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Takes indices from the shared counter until 'end' is reached.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+    void run() override
+    {
+        for (int i = m_next->fetchAndAddRelaxed(1); i < m_end; i = m_next->fetchAndAddRelaxed(1))
+        {
+            m_work(i);
+        }
+    }
+
+private:
+
+    QAtomicInt*               m_next;
+    int                       m_end;
+    std::function<void(int)>  m_work;
+};
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// \class QArgumentRunnable
+///
+/// Used by QArgumentParser to validate blocks and jobs and by
+/// QArgumentFileCache to query paths. The class is private to the library.
+///
+////////////////////////////////////////////////////////////////////////////////
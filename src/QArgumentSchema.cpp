@@ -0,0 +1,249 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <QArgumentParser/QArgumentSchema.hpp>
+
+QArgumentSchemaBase::QArgumentSchemaBase()
+    : m_optionIndicator("-")
+{
+}
+
+const QArgumentError& QArgumentSchemaBase::error() const
+{
+    return m_error;
+}
+
+const QString& QArgumentSchemaBase::errorMessage() const
+{
+    // Formatted once per failure, on request.
+    if (m_errorMessage.isNull() && m_error.code() != QArgumentError::NoError)
+    {
+        m_errorMessage = m_error.message();
+    }
+
+    return m_errorMessage;
+}
+
+const QString& QArgumentSchemaBase::optionIndicator() const
+{
+    return m_optionIndicator;
+}
+
+void QArgumentSchemaBase::setOptionIndicator(const QString& indicator)
+{
+    if (indicator.isEmpty())
+        m_optionIndicator = "-";
+    else
+        m_optionIndicator = indicator;
+}
+
+bool QArgumentSchemaBase::convert(
+    Tag<QArgumentValidatorOption::Char>,
+    const QArgumentToken& s,
+    char* value,
+    QArgumentError* error)
+{
+    QArgumentValue converted;
+    if (!QArgumentValidator::validateChar(s, &converted, error))
+        return false;
+
+    *value = converted.toIntegral<char>();
+    return true;
+}
+
+bool QArgumentSchemaBase::convert(
+    Tag<QArgumentValidatorOption::UInt8>,
+    const QArgumentToken& s,
+    uchar* value,
+    QArgumentError* error)
+{
+    QArgumentValue converted;
+    if (!QArgumentValidator::validateUChar(s, &converted, error))
+        return false;
+
+    *value = converted.toIntegral<uchar>();
+    return true;
+}
+
+bool QArgumentSchemaBase::convert(
+    Tag<QArgumentValidatorOption::Int16>,
+    const QArgumentToken& s,
+    short* value,
+    QArgumentError* error)
+{
+    QArgumentValue converted;
+    if (!QArgumentValidator::validateShort(s, &converted, error))
+        return false;
+
+    *value = converted.toIntegral<short>();
+    return true;
+}
+
+bool QArgumentSchemaBase::convert(
+    Tag<QArgumentValidatorOption::UInt16>,
+    const QArgumentToken& s,
+    ushort* value,
+    QArgumentError* error)
+{
+    QArgumentValue converted;
+    if (!QArgumentValidator::validateUShort(s, &converted, error))
+        return false;
+
+    *value = converted.toIntegral<ushort>();
+    return true;
+}
+
+bool QArgumentSchemaBase::convert(
+    Tag<QArgumentValidatorOption::Int32>,
+    const QArgumentToken& s,
+    int* value,
+    QArgumentError* error)
+{
+    QArgumentValue converted;
+    if (!QArgumentValidator::validateInt(s, &converted, error))
+        return false;
+
+    *value = converted.toIntegral<int>();
+    return true;
+}
+
+bool QArgumentSchemaBase::convert(
+    Tag<QArgumentValidatorOption::UInt32>,
+    const QArgumentToken& s,
+    uint* value,
+    QArgumentError* error)
+{
+    QArgumentValue converted;
+    if (!QArgumentValidator::validateUInt(s, &converted, error))
+        return false;
+
+    *value = converted.toIntegral<uint>();
+    return true;
+}
+
+bool QArgumentSchemaBase::convert(
+    Tag<QArgumentValidatorOption::Int64>,
+    const QArgumentToken& s,
+    qint64* value,
+    QArgumentError* error)
+{
+    QArgumentValue converted;
+    if (!QArgumentValidator::validateInt64(s, &converted, error))
+        return false;
+
+    *value = converted.toIntegral<qint64>();
+    return true;
+}
+
+bool QArgumentSchemaBase::convert(
+    Tag<QArgumentValidatorOption::UInt64>,
+    const QArgumentToken& s,
+    quint64* value,
+    QArgumentError* error)
+{
+    QArgumentValue converted;
+    if (!QArgumentValidator::validateUInt64(s, &converted, error))
+        return false;
+
+    *value = converted.toIntegral<quint64>();
+    return true;
+}
+
+bool QArgumentSchemaBase::convert(
+    Tag<QArgumentValidatorOption::String>,
+    const QArgumentToken& s,
+    QArgumentToken* value,
+    QArgumentError*)
+{
+    *value = s;
+    return true;
+}
+
+bool QArgumentSchemaBase::convert(
+    Tag<QArgumentValidatorOption::File>,
+    const QArgumentToken& s,
+    QArgumentToken* value,
+    QArgumentError* error)
+{
+    if (!QArgumentValidator::validateFile(s, nullptr, error))
+        return false;
+
+    *value = s;
+    return true;
+}
+
+bool QArgumentSchemaBase::convert(
+    Tag<QArgumentValidatorOption::Directory>,
+    const QArgumentToken& s,
+    QArgumentToken* value,
+    QArgumentError* error)
+{
+    if (!QArgumentValidator::validateDirectory(s, nullptr, error))
+        return false;
+
+    *value = s;
+    return true;
+}
+
+bool QArgumentSchemaBase::convert(
+    Tag<QArgumentValidatorOption::MappedFile>,
+    const QArgumentToken& s,
+    QSharedPointer<const QArgumentMappedFile>* value,
+    QArgumentError* error)
+{
+    QArgumentValue converted;
+    if (!QArgumentValidator::validateMappedFile(s, &converted, error))
+        return false;
+
+    *value = converted.mappedFile();
+    return true;
+}
+
+bool QArgumentSchemaBase::matches(const QArgumentToken& token, const char* name, int size)
+{
+    return token.size() == size && std::memcmp(token.utf8(), name, size) == 0;
+}
+
+void QArgumentSchemaBase::setInvalidOption(const QArgumentToken& name)
+{
+    m_error = QArgumentError(QArgumentError::InvalidOption);
+    m_error.setOption(name);
+}
+
+void QArgumentSchemaBase::setInvalidCount(const char* name, int count, int expected)
+{
+    m_error = QArgumentError(QArgumentError::InvalidArgumentCount);
+    m_error.setOption(QArgumentToken::fromUtf8(name));
+    m_error.setCount(count, expected, expected);
+}
+
+void QArgumentSchemaBase::setMissingRequired(const char* name)
+{
+    m_error = QArgumentError(QArgumentError::MissingRequiredOption);
+    m_error.setOption(QArgumentToken::fromUtf8(name));
+}
+
+void QArgumentSchemaBase::clearError()
+{
+    m_error = QArgumentError();
+    m_errorMessage = QString();
+}
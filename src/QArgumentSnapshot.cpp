@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <QArgumentParser/QArgumentSnapshot.hpp>
+
+QArgumentSnapshot::QArgumentSnapshot()
+    : m_validator(new QArgumentValidator)
+{
+}
+
+const QString& QArgumentSnapshot::firstArgument() const
+{
+    return m_firstArgument;
+}
+
+const QArgumentOption& QArgumentSnapshot::option(const QString& name) const
+{
+    if (m_validator->optionCount() > 0)
+    {
+        auto index = m_validator->indexOf(name);
+        if (index == -1 || index >= m_optionSlots.size() || m_optionSlots.at(index) < 0)
+        {
+            return m_defaultOption;
+        }
+
+        return m_options.at(m_optionSlots.at(index));
+    }
+
+    for (const auto& option : m_options)
+    {
+        if (option.option() == name)
+        {
+            return option;
+        }
+    }
+
+    return m_defaultOption;
+}
+
+QArgumentOptionView QArgumentSnapshot::optionView(const QString& name) const
+{
+    return QArgumentOptionView(option(name));
+}
+
+int QArgumentSnapshot::optionCount() const
+{
+    return m_options.size();
+}
+
+QArgumentOptionView::Iterator QArgumentSnapshot::begin() const
+{
+    return QArgumentOptionView::Iterator(m_options.constData());
+}
+
+QArgumentOptionView::Iterator QArgumentSnapshot::end() const
+{
+    return QArgumentOptionView::Iterator(m_options.constData() + m_options.size());
+}
+
+const QArgumentValidator& QArgumentSnapshot::validator() const
+{
+    return *m_validator;
+}
@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <QArgumentParser/QArgumentStatistics.hpp>
+
+// The statistics of the parse running on this thread, if it collects any.
+Anonymous(thread_local QArgumentStatistics* t_current = nullptr)
+
+Anonymous(const char* const c_phaseNames[] =
+{
+    "tokenization",
+    "lookup",
+    "validation",
+    "path_check",
+    "required_check"
+})
+
+Anonymous(const char* const c_counterNames[] =
+{
+    "tokens",
+    "options",
+    "string_allocations",
+    "file_probes"
+})
+
+QArgumentStatistics::QArgumentStatistics()
+{
+    clear();
+}
+
+qint64 QArgumentStatistics::elapsed(Phase phase) const
+{
+    if (phase < 0 || phase >= PhaseCount)
+    {
+        return 0;
+    }
+
+    if (phase != Tokenization)
+    {
+        return m_elapsed[phase];
+    }
+
+    // Tokenization is whatever the measured phases leave over.
+    auto remaining = m_totalElapsed;
+    for (int i = Lookup; i < PhaseCount; i++)
+    {
+        remaining -= m_elapsed[i];
+    }
+
+    return qMax<qint64>(remaining, 0);
+}
+
+qint64 QArgumentStatistics::totalElapsed() const
+{
+    return m_totalElapsed;
+}
+
+qint64 QArgumentStatistics::count(Counter counter) const
+{
+    if (counter < 0 || counter >= CounterCount)
+    {
+        return 0;
+    }
+
+    return m_counters[counter];
+}
+
+qint64 QArgumentStatistics::retainedBytes() const
+{
+    return m_retainedBytes;
+}
+
+QByteArray QArgumentStatistics::toJson() const
+{
+    QByteArray json("{\"elapsed_ns\":{\"total\":");
+    json += QByteArray::number(m_totalElapsed);
+
+    for (int i = 0; i < PhaseCount; i++)
+    {
+        json += ",\"";
+        json += c_phaseNames[i];
+        json += "\":";
+        json += QByteArray::number(elapsed(static_cast<Phase>(i)));
+    }
+
+    json += "}";
+    for (int i = 0; i < CounterCount; i++)
+    {
+        json += ",\"";
+        json += c_counterNames[i];
+        json += "\":";
+        json += QByteArray::number(m_counters[i]);
+    }
+
+    json += ",\"retained_bytes\":";
+    json += QByteArray::number(m_retainedBytes);
+    json += "}";
+
+    return json;
+}
+
+void QArgumentStatistics::record(Counter counter, qint64 amount)
+{
+    if (t_current != nullptr)
+    {
+        t_current->m_counters[counter] += amount;
+    }
+}
+
+void QArgumentStatistics::clear()
+{
+    for (auto& elapsed : m_elapsed)
+        elapsed = 0;
+    for (auto& counter : m_counters)
+        counter = 0;
+
+    m_totalElapsed = 0;
+    m_retainedBytes = 0;
+}
+
+QArgumentStatistics::Scope::Scope(QArgumentStatistics* statistics)
+    : m_previous(t_current)
+    , m_statistics(statistics)
+{
+    if (m_statistics != nullptr)
+    {
+        m_statistics->clear();
+        m_timer.start();
+        t_current = m_statistics;
+    }
+}
+
+QArgumentStatistics::Scope::~Scope()
+{
+    if (m_statistics != nullptr)
+    {
+        m_statistics->m_totalElapsed = m_timer.nsecsElapsed();
+        t_current = m_previous;
+    }
+}
+
+QArgumentStatistics::PhaseTimer::PhaseTimer(Phase phase)
+    : m_statistics(t_current)
+    , m_phase(phase)
+{
+    if (m_statistics != nullptr)
+    {
+        m_timer.start();
+    }
+}
+
+QArgumentStatistics::PhaseTimer::~PhaseTimer()
+{
+    if (m_statistics != nullptr)
+    {
+        m_statistics->m_elapsed[m_phase] += m_timer.nsecsElapsed();
+    }
+}
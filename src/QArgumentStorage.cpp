@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <QArgumentParser/QArgumentStorage.hpp>
+
+Anonymous(const QArgumentValue c_nullValue)
+
+QArgumentStorage::QArgumentStorage(const QArgumentStorage& other)
+    : QSharedData(other)
+    , m_values(other.m_values)
+    , m_files(other.m_files)
+    , m_arena(other.m_arena)
+    , m_responseFiles(other.m_responseFiles)
+    , m_tokenStorage(other.m_tokenStorage)
+{
+    // File handles belong to the options of the copied storage.
+}
+
+int QArgumentStorage::valueCount() const
+{
+    return m_values.size();
+}
+
+const QArgumentValue& QArgumentStorage::valueAt(int index) const
+{
+    if (index < 0 || index >= m_values.size())
+    {
+        return c_nullValue;
+    }
+
+    return m_values.at(index);
+}
+
+const QArgumentFileCache& QArgumentStorage::files() const
+{
+    return m_files;
+}
+
+bool QArgumentStorage::isShared() const
+{
+    return ref.loadAcquire() > 1;
+}
+
+QFile* QArgumentStorage::fileHandle(int index) const
+{
+    if (index < 0 || index >= m_values.size())
+    {
+        return nullptr;
+    }
+
+    if (m_hasFixedFileHandles)
+    {
+        return index < m_fileHandles.size() ? m_fileHandles.at(index).data() : nullptr;
+    }
+
+    QMutexLocker lock(&m_fileHandleMutex);
+    if (m_fileHandles.size() < m_values.size())
+    {
+        m_fileHandles.resize(m_values.size());
+    }
+
+    auto& handle = m_fileHandles[index];
+    if (handle.isNull())
+    {
+        handle.reset(new QFile(m_values.at(index).text()));
+    }
+
+    return handle.data();
+}
+
+void QArgumentStorage::clear()
+{
+    // Keeps the capacity of the values for the next parse.
+    m_values.clear();
+    m_files.clear();
+    m_arena.clear();
+    m_responseFiles.clear();
+    m_tokenStorage.clear();
+    m_fileHandles.clear();
+    m_hasFixedFileHandles = false;
+}
+
+void QArgumentStorage::createFileHandles()
+{
+    m_fileHandles.resize(m_values.size());
+    for (int i = 0; i < m_values.size(); i++)
+    {
+        if (m_values.at(i).type() == QArgumentValidatorOption::File)
+        {
+            m_fileHandles[i].reset(new QFile(m_values.at(i).text()));
+        }
+    }
+
+    m_hasFixedFileHandles = true;
+}
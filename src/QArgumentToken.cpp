@@ -0,0 +1,657 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <QArgumentParser/QArgumentStatistics.hpp>
+#include <QArgumentParser/QArgumentToken.hpp>
+#include <climits>
+#include <cstring>
+
+#if defined(Q_PROCESSOR_X86) && (defined(Q_CC_GNU) || defined(Q_CC_CLANG) || defined(Q_CC_MSVC))
+    #define QARGUMENTPARSER_SSE41
+    #include <immintrin.h>
+    #if defined(Q_CC_MSVC)
+        #include <intrin.h>
+        #define QARGUMENTPARSER_TARGET_SSE41
+        #define QARGUMENTPARSER_TARGET_AVX2
+    #else
+        #define QARGUMENTPARSER_TARGET_SSE41 __attribute__((target("sse4.1")))
+        #define QARGUMENTPARSER_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+Anonymous(inline bool isAsciiSpace(uint c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+})
+
+// Retrieves the length of the UTF-8 sequence at 'data' if it encodes a space
+// as of QChar::isSpace, which QString::trimmed removes, or zero otherwise.
+Anonymous(int spaceLength(const uchar* data, int size)
+{
+    if (data[0] < 0x80)
+    {
+        return isAsciiSpace(data[0]) ? 1 : 0;
+    }
+
+    // All non-ASCII spaces lie below U+10000, in two or three bytes.
+    uint codePoint = 0;
+    int length = 0;
+    if ((data[0] & 0xE0) == 0xC0)
+    {
+        codePoint = data[0] & 0x1F;
+        length = 2;
+    }
+    else if ((data[0] & 0xF0) == 0xE0)
+    {
+        codePoint = data[0] & 0x0F;
+        length = 3;
+    }
+
+    if (length == 0 || length > size)
+    {
+        return 0;
+    }
+
+    for (int i = 1; i < length; i++)
+    {
+        if ((data[i] & 0xC0) != 0x80)
+        {
+            return 0;
+        }
+
+        codePoint = (codePoint << 6) | (data[i] & 0x3F);
+    }
+
+    // Overlong sequences decode to U+FFFD, which is no space.
+    if (codePoint < (length == 2 ? 0x80u : 0x800u))
+    {
+        return 0;
+    }
+
+    return QChar::isSpace(codePoint) ? length : 0;
+})
+
+// The longest decimal that fits into 64 bits has 20 digits.
+Anonymous(QARGUMENTPARSER_CONSTEXPR int c_maxDigits = 20)
+
+// Converts 1 to 20 ASCII digits. Fails on anything else and on overflow.
+Anonymous(typedef bool (*DigitKernel)(const char*, int, quint64*))
+
+Anonymous(bool parseDigitsScalar(const char* digits, int count, quint64* value)
+{
+    quint64 result = 0;
+    for (int i = 0; i < count; i++)
+    {
+        auto digit = static_cast<uint>(static_cast<uchar>(digits[i])) - '0';
+        if (digit > 9)
+        {
+            return false;
+        }
+
+        // Only the twentieth digit can overflow.
+        if (i == c_maxDigits - 1 && result > (ULLONG_MAX - digit) / 10)
+        {
+            return false;
+        }
+
+        result = result * 10 + digit;
+    }
+
+    *value = result;
+    return true;
+})
+
+#if defined(QARGUMENTPARSER_SSE41)
+Anonymous(QARGUMENTPARSER_TARGET_SSE41 bool parseDigitsSse41(const char* digits, int count, quint64* value)
+{
+    // Up to four leading digits do not fit into the vector.
+    auto head = count > 16 ? count - 16 : 0;
+    quint64 headValue = 0;
+    if (head > 0 && !parseDigitsScalar(digits, head, &headValue))
+    {
+        return false;
+    }
+
+    // Left-padding with zeros keeps the value of the remaining digits.
+    char buffer[16];
+    std::memset(buffer, '0', sizeof(buffer));
+    std::memcpy(buffer + 16 - (count - head), digits + head, count - head);
+
+    const __m128i nine = _mm_set1_epi8(9);
+    __m128i chunk = _mm_sub_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer)),
+        _mm_set1_epi8('0'));
+
+    // Every byte must be at most nine, compared unsigned.
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(chunk, nine), nine)) != 0xFFFF)
+    {
+        return false;
+    }
+
+    // Combines digits into pairs, quadruples and octuples.
+    __m128i pairs = _mm_maddubs_epi16(chunk, _mm_setr_epi8(
+        10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+    __m128i quads = _mm_madd_epi16(pairs, _mm_setr_epi16(
+        100, 1, 100, 1, 100, 1, 100, 1));
+    __m128i octs = _mm_madd_epi16(_mm_packus_epi32(quads, quads), _mm_setr_epi16(
+        10000, 1, 10000, 1, 10000, 1, 10000, 1));
+
+    auto high = static_cast<quint64>(static_cast<quint32>(_mm_cvtsi128_si32(octs)));
+    auto low = static_cast<quint64>(static_cast<quint32>(_mm_extract_epi32(octs, 1)));
+    auto tail = high * Q_UINT64_C(100000000) + low;
+
+    // 18446744073709551615 = 1844 * 10^16 + 6744073709551615
+    if (headValue > 1844 || (headValue == 1844 && tail > Q_UINT64_C(6744073709551615)))
+    {
+        return false;
+    }
+
+    *value = headValue * Q_UINT64_C(10000000000000000) + tail;
+    return true;
+})
+
+Anonymous(QARGUMENTPARSER_TARGET_AVX2 bool parseDigitsAvx2(const char* digits, int count, quint64* value)
+{
+    // Left-padding with zeros keeps the value; all 20 digits fit at once.
+    char buffer[32];
+    std::memset(buffer, '0', sizeof(buffer));
+    std::memcpy(buffer + 32 - count, digits, count);
+
+    const __m256i nine = _mm256_set1_epi8(9);
+    __m256i chunk = _mm256_sub_epi8(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(buffer)),
+        _mm256_set1_epi8('0'));
+
+    if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(chunk, nine), nine)) != -1)
+    {
+        return false;
+    }
+
+    // Like the SSE4.1 kernel, but per 128-bit lane: octuples 0 and 1 in the
+    // low lane, 2 and 3 in the high one. Octuple 0 holds padding only.
+    __m256i pairs = _mm256_maddubs_epi16(chunk, _mm256_setr_epi8(
+        10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1,
+        10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+    __m256i quads = _mm256_madd_epi16(pairs, _mm256_setr_epi16(
+        100, 1, 100, 1, 100, 1, 100, 1, 100, 1, 100, 1, 100, 1, 100, 1));
+    __m256i octs = _mm256_madd_epi16(_mm256_packus_epi32(quads, quads), _mm256_setr_epi16(
+        10000, 1, 10000, 1, 10000, 1, 10000, 1, 10000, 1, 10000, 1, 10000, 1, 10000, 1));
+
+    __m128i low = _mm256_castsi256_si128(octs);
+    __m128i high = _mm256_extracti128_si256(octs, 1);
+    auto head = static_cast<quint64>(static_cast<quint32>(_mm_extract_epi32(low, 1)));
+    auto tail = static_cast<quint64>(static_cast<quint32>(_mm_cvtsi128_si32(high))) * Q_UINT64_C(100000000) +
+                static_cast<quint64>(static_cast<quint32>(_mm_extract_epi32(high, 1)));
+
+    // 18446744073709551615 = 1844 * 10^16 + 6744073709551615
+    if (head > 1844 || (head == 1844 && tail > Q_UINT64_C(6744073709551615)))
+    {
+        return false;
+    }
+
+    *value = head * Q_UINT64_C(10000000000000000) + tail;
+    return true;
+})
+
+Anonymous(bool hasSse41()
+{
+#if defined(Q_CC_MSVC)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 19)) != 0;
+#else
+    // Runs from a static initializer, possibly before libgcc initialized the
+    // CPU model it queries.
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.1");
+#endif
+})
+
+Anonymous(bool hasAvx2()
+{
+#if defined(Q_CC_MSVC)
+    // AVX2 also requires the OS to save the YMM registers.
+    int info[4];
+    __cpuid(info, 1);
+    if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 6) != 6)
+    {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+})
+#endif
+
+Anonymous(DigitKernel selectDigitKernel()
+{
+#if defined(QARGUMENTPARSER_SSE41)
+    if (hasAvx2())
+    {
+        return parseDigitsAvx2;
+    }
+
+    if (hasSse41())
+    {
+        return parseDigitsSse41;
+    }
+#endif
+
+    return parseDigitsScalar;
+})
+
+Anonymous(const DigitKernel c_parseDigits = selectDigitKernel())
+
+// Converts canonical decimals, i.e. an optional minus sign followed by digits.
+// Anything else, like whitespace, a plus sign or overflow, is left to QString,
+// so accepting and rejecting stays exactly as before.
+Anonymous(bool parseCanonical(
+    const QArgumentToken& token,
+    bool isSigned,
+    quint64* magnitude,
+    bool* isNegative)
+{
+    auto size = token.size();
+    if (size == 0 || size > c_maxDigits + 1)
+    {
+        return false;
+    }
+
+    char narrowed[c_maxDigits + 1];
+    const char* digits = token.utf8();
+    if (token.encoding() == QArgumentToken::Utf16)
+    {
+        const QChar* units = token.utf16().data();
+        for (int i = 0; i < size; i++)
+        {
+            auto unit = units[i].unicode();
+            if (unit > 0x7F)
+            {
+                return false;
+            }
+
+            narrowed[i] = static_cast<char>(unit);
+        }
+
+        digits = narrowed;
+    }
+
+    *isNegative = isSigned && digits[0] == '-';
+    if (*isNegative)
+    {
+        digits++;
+        size--;
+    }
+
+    if (size == 0 || size > c_maxDigits)
+    {
+        return false;
+    }
+
+    return c_parseDigits(digits, size, magnitude);
+})
+
+Anonymous(bool parseSigned(const QArgumentToken& token, qint64 min, qint64 max, qint64* value)
+{
+    quint64 magnitude = 0;
+    bool isNegative = false;
+    if (!parseCanonical(token, true, &magnitude, &isNegative))
+    {
+        return false;
+    }
+
+    if (isNegative)
+    {
+        if (magnitude > static_cast<quint64>(-(min + 1)) + 1)
+        {
+            return false;
+        }
+
+        *value = magnitude == 0 ? 0 : -static_cast<qint64>(magnitude - 1) - 1;
+    }
+    else
+    {
+        if (magnitude > static_cast<quint64>(max))
+        {
+            return false;
+        }
+
+        *value = static_cast<qint64>(magnitude);
+    }
+
+    return true;
+})
+
+Anonymous(bool parseUnsigned(const QArgumentToken& token, quint64 max, quint64* value)
+{
+    bool isNegative = false;
+    return parseCanonical(token, false, value, &isNegative) && *value <= max;
+})
+
+QArgumentToken::QArgumentToken()
+    : m_data(nullptr)
+    , m_size(0)
+    , m_encoding(Utf8)
+{
+}
+
+QArgumentToken QArgumentToken::fromUtf8(const char* data, int size)
+{
+    QArgumentToken token;
+    token.m_data = data;
+    token.m_size = size >= 0 ? size : (data ? static_cast<int>(std::strlen(data)) : 0);
+    token.m_encoding = Utf8;
+
+    return token;
+}
+
+QArgumentToken QArgumentToken::fromUtf16(QStringView view)
+{
+    QArgumentToken token;
+    token.m_data = view.data();
+    token.m_size = static_cast<int>(view.size());
+    token.m_encoding = Utf16;
+
+    return token;
+}
+
+QArgumentToken QArgumentToken::trimmed() const
+{
+    QArgumentToken token = *this;
+    if (m_encoding == Utf16)
+    {
+        return fromUtf16(utf16().trimmed());
+    }
+
+    auto data = reinterpret_cast<const uchar*>(utf8());
+    auto begin = 0;
+    auto end = m_size;
+    while (begin < end)
+    {
+        auto length = spaceLength(data + begin, end - begin);
+        if (length == 0)
+        {
+            break;
+        }
+
+        begin += length;
+    }
+
+    while (begin < end)
+    {
+        // Steps back to the lead byte of the last sequence.
+        auto last = end - 1;
+        while (last > begin && last > end - 3 && (data[last] & 0xC0) == 0x80)
+        {
+            last--;
+        }
+
+        if (spaceLength(data + last, end - last) != end - last)
+        {
+            break;
+        }
+
+        end = last;
+    }
+
+    token.m_data = utf8() + begin;
+    token.m_size = end - begin;
+    return token;
+}
+
+QArgumentToken QArgumentToken::mid(int position) const
+{
+    position = qBound(0, position, m_size);
+
+    QArgumentToken token = *this;
+    token.m_size -= position;
+    token.m_data = m_encoding == Utf8
+        ? static_cast<const void*>(utf8() + position)
+        : static_cast<const void*>(static_cast<const QChar*>(m_data) + position);
+
+    return token;
+}
+
+int QArgumentToken::prefixLength(const QString& prefix) const
+{
+    if (m_encoding == Utf16)
+    {
+        return utf16().startsWith(QStringView(prefix)) ? prefix.size() : -1;
+    }
+
+    // The option indicator is plain ASCII in virtually every case, which can
+    // be compared against the UTF-8 bytes directly.
+    for (int i = 0; i < prefix.size(); i++)
+    {
+        if (prefix.at(i).unicode() >= 0x80)
+        {
+            QByteArray encoded = prefix.toUtf8();
+            if (encoded.size() > m_size ||
+                std::memcmp(utf8(), encoded.constData(), encoded.size()) != 0)
+            {
+                return -1;
+            }
+
+            return encoded.size();
+        }
+
+        if (i >= m_size || unitAt(i) != prefix.at(i).unicode())
+        {
+            return -1;
+        }
+    }
+
+    return prefix.size();
+}
+
+bool QArgumentToken::isPrefixOf(const QString& other) const
+{
+    if (m_encoding == Utf16)
+    {
+        return QStringView(other).startsWith(utf16());
+    }
+
+    // Like prefixLength, compares ASCII unit by unit and decodes otherwise.
+    for (int i = 0; i < m_size; i++)
+    {
+        uint unit = unitAt(i);
+        if (unit >= 0x80)
+        {
+            return other.startsWith(toString());
+        }
+
+        if (i >= other.size() || other.at(i).unicode() != unit)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int QArgumentToken::compare(const QString& other) const
+{
+    if (m_encoding == Utf16)
+    {
+        return utf16().compare(QStringView(other));
+    }
+
+    int length = qMin(m_size, other.size());
+    for (int i = 0; i < length; i++)
+    {
+        uint a = unitAt(i);
+        uint b = other.at(i).unicode();
+
+        // Multi-byte sequences can not be compared unit by unit.
+        if (a >= 0x80)
+        {
+            return QString::compare(toString(), other);
+        }
+        else if (a != b)
+        {
+            return a < b ? -1 : 1;
+        }
+    }
+
+    if (m_size > length)
+    {
+        return QString::compare(toString(), other);
+    }
+
+    return m_size == other.size() ? 0 : -1;
+}
+
+bool QArgumentToken::equals(QLatin1String other) const
+{
+    if (m_size != other.size())
+    {
+        return false;
+    }
+
+    for (int i = 0; i < m_size; i++)
+    {
+        if (unitAt(i) != static_cast<uchar>(other.data()[i]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+QString QArgumentToken::toString() const
+{
+    QARGUMENTPARSER_STATISTICS(QArgumentStatistics::record(QArgumentStatistics::StringAllocations));
+
+    if (m_encoding == Utf16)
+    {
+        return utf16().toString();
+    }
+
+    return QString::fromUtf8(utf8(), m_size);
+}
+
+short QArgumentToken::toShort(bool* ok) const
+{
+    qint64 value = 0;
+    if (parseSigned(*this, SHRT_MIN, SHRT_MAX, &value))
+    {
+        if (ok != nullptr)
+            *ok = true;
+
+        return static_cast<short>(value);
+    }
+
+    if (m_encoding == Utf16)
+        return QString::fromRawData(utf16().data(), m_size).toShort(ok);
+
+    return QString::fromUtf8(utf8(), m_size).toShort(ok);
+}
+
+ushort QArgumentToken::toUShort(bool* ok) const
+{
+    quint64 value = 0;
+    if (parseUnsigned(*this, USHRT_MAX, &value))
+    {
+        if (ok != nullptr)
+            *ok = true;
+
+        return static_cast<ushort>(value);
+    }
+
+    if (m_encoding == Utf16)
+        return QString::fromRawData(utf16().data(), m_size).toUShort(ok);
+
+    return QString::fromUtf8(utf8(), m_size).toUShort(ok);
+}
+
+int QArgumentToken::toInt(bool* ok) const
+{
+    qint64 value = 0;
+    if (parseSigned(*this, INT_MIN, INT_MAX, &value))
+    {
+        if (ok != nullptr)
+            *ok = true;
+
+        return static_cast<int>(value);
+    }
+
+    if (m_encoding == Utf16)
+        return QString::fromRawData(utf16().data(), m_size).toInt(ok);
+
+    return QString::fromUtf8(utf8(), m_size).toInt(ok);
+}
+
+uint QArgumentToken::toUInt(bool* ok) const
+{
+    quint64 value = 0;
+    if (parseUnsigned(*this, UINT_MAX, &value))
+    {
+        if (ok != nullptr)
+            *ok = true;
+
+        return static_cast<uint>(value);
+    }
+
+    if (m_encoding == Utf16)
+        return QString::fromRawData(utf16().data(), m_size).toUInt(ok);
+
+    return QString::fromUtf8(utf8(), m_size).toUInt(ok);
+}
+
+qint64 QArgumentToken::toLongLong(bool* ok) const
+{
+    qint64 value = 0;
+    if (parseSigned(*this, LLONG_MIN, LLONG_MAX, &value))
+    {
+        if (ok != nullptr)
+            *ok = true;
+
+        return static_cast<qint64>(value);
+    }
+
+    if (m_encoding == Utf16)
+        return QString::fromRawData(utf16().data(), m_size).toLongLong(ok);
+
+    return QString::fromUtf8(utf8(), m_size).toLongLong(ok);
+}
+
+quint64 QArgumentToken::toULongLong(bool* ok) const
+{
+    quint64 value = 0;
+    if (parseUnsigned(*this, ULLONG_MAX, &value))
+    {
+        if (ok != nullptr)
+            *ok = true;
+
+        return static_cast<quint64>(value);
+    }
+
+    if (m_encoding == Utf16)
+        return QString::fromRawData(utf16().data(), m_size).toULongLong(ok);
+
+    return QString::fromUtf8(utf8(), m_size).toULongLong(ok);
+}
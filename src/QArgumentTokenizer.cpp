@@ -0,0 +1,368 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <QArgumentParser/QArgumentTokenizer.hpp>
+#include <algorithm>
+#include <cstring>
+
+Anonymous(template<typename Char> inline bool isAsciiSpace(Char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+})
+
+Anonymous(inline QArgumentToken makeToken(const char* data, int size)
+{
+    return QArgumentToken::fromUtf8(data, size);
+})
+
+Anonymous(inline QArgumentToken makeToken(const char16_t* data, int size)
+{
+    return QArgumentToken::fromUtf16(QStringView(data, size));
+})
+
+Anonymous(inline const char* findNul(const char* data, int size)
+{
+    return static_cast<const char*>(std::memchr(data, '\0', size));
+})
+
+Anonymous(inline const char16_t* findNul(const char16_t* data, int size)
+{
+    auto end = std::find(data, data + size, u'\0');
+    return end != data + size ? end : nullptr;
+})
+
+Anonymous(template<typename Char> inline void append(QByteArray* out, const Char* data, int size)
+{
+    // UTF-16 code units are stored as raw bytes and viewed in place later.
+    out->append(reinterpret_cast<const char*>(data), size * static_cast<int>(sizeof(Char)));
+})
+
+Anonymous(template<typename Char> inline bool isShellEscape(Char c)
+{
+    return c == '$' || c == '`' || c == '"' || c == '\\' || c == '\n';
+})
+
+QArgumentTokenizer::QArgumentTokenizer(Mode mode)
+    : m_data(nullptr)
+    , m_utf16(nullptr)
+    , m_size(0)
+    , m_position(0)
+    , m_mode(mode)
+    , m_comment('\0')
+    , m_isFinal(true)
+    , m_hasError(false)
+    , m_storage(nullptr)
+    , m_arena(nullptr)
+{
+}
+
+QArgumentTokenizer::Mode QArgumentTokenizer::mode() const
+{
+    return m_mode;
+}
+
+int QArgumentTokenizer::position() const
+{
+    return m_position;
+}
+
+bool QArgumentTokenizer::hasError() const
+{
+    return m_hasError;
+}
+
+char QArgumentTokenizer::commentCharacter() const
+{
+    return m_comment;
+}
+
+void QArgumentTokenizer::setMode(Mode mode)
+{
+    m_mode = mode;
+}
+
+void QArgumentTokenizer::setCommentCharacter(char comment)
+{
+    m_comment = comment;
+}
+
+void QArgumentTokenizer::setStorage(QVector<QByteArray>* storage)
+{
+    m_storage = storage;
+}
+
+void QArgumentTokenizer::setArena(QArgumentArena* arena)
+{
+    m_arena = arena;
+}
+
+void QArgumentTokenizer::setData(const char* data, int size, bool isFinal)
+{
+    m_data = data;
+    m_utf16 = nullptr;
+    m_size = size;
+    m_position = 0;
+    m_isFinal = isFinal;
+    m_hasError = false;
+}
+
+void QArgumentTokenizer::setData(QStringView data, bool isFinal)
+{
+    m_data = nullptr;
+    m_utf16 = reinterpret_cast<const char16_t*>(data.data());
+    m_size = static_cast<int>(data.size());
+    m_position = 0;
+    m_isFinal = isFinal;
+    m_hasError = false;
+}
+
+bool QArgumentTokenizer::next(QArgumentToken* token)
+{
+    if (m_mode == NulSeparated)
+    {
+        return m_utf16 != nullptr
+            ? nextNulSeparated(m_utf16, token)
+            : nextNulSeparated(m_data, token);
+    }
+
+    return m_utf16 != nullptr
+        ? nextWords(m_utf16, token)
+        : nextWords(m_data, token);
+}
+
+template<typename Char>
+bool QArgumentTokenizer::skipSpaceAndComments(const Char* data)
+{
+    for (;;)
+    {
+        // Escaped newlines between tokens join lines in shell mode.
+        while (m_position < m_size)
+        {
+            if (isAsciiSpace(data[m_position]))
+                m_position++;
+            else if (m_mode == Shell && data[m_position] == '\\' &&
+                     m_position + 1 < m_size && data[m_position + 1] == '\n')
+                m_position += 2;
+            else
+                break;
+        }
+
+        if (m_position >= m_size || m_comment == '\0' || data[m_position] != Char(m_comment))
+        {
+            return m_position < m_size;
+        }
+
+        // The rest of the comment might be in the next chunk.
+        int start = m_position;
+        while (m_position < m_size && data[m_position] != '\n')
+        {
+            m_position++;
+        }
+
+        if (m_position >= m_size && isIncomplete(start))
+        {
+            return false;
+        }
+    }
+}
+
+template<typename Char>
+bool QArgumentTokenizer::nextWords(const Char* data, QArgumentToken* token)
+{
+    if (!skipSpaceAndComments(data))
+    {
+        return false;
+    }
+
+    // Plain tokens are viewed in place.
+    int start = m_position;
+    while (m_position < m_size)
+    {
+        Char c = data[m_position];
+        if (isAsciiSpace(c) || c == '\'' || c == '"' || c == '\\')
+            break;
+
+        m_position++;
+    }
+
+    if (m_position >= m_size && isIncomplete(start))
+    {
+        return false;
+    }
+    else if (m_position >= m_size || isAsciiSpace(data[m_position]))
+    {
+        *token = makeToken(data + start, m_position - start);
+        return true;
+    }
+
+    // Tokens that are quoted as a whole are viewed in place, too.
+    Char c = data[m_position];
+    if (m_position == start && (c == '\'' || c == '"'))
+    {
+        int end = m_position + 1;
+        while (end < m_size && data[end] != c && (c == '\'' || data[end] != '\\'))
+        {
+            end++;
+        }
+
+        if (end + 1 >= m_size && isIncomplete(start))
+        {
+            return false;
+        }
+        else if (end < m_size && data[end] == c &&
+           (end + 1 >= m_size || isAsciiSpace(data[end + 1])))
+        {
+            *token = makeToken(data + start + 1, end - start - 1);
+            m_position = end + 1;
+            return true;
+        }
+    }
+
+    // Everything else has its quotes and escapes removed into the storage.
+    QByteArray* out = storage();
+    append(out, data + start, m_position - start);
+
+    bool isShell = m_mode == Shell;
+    Char quote = 0;
+    while (m_position < m_size)
+    {
+        c = data[m_position];
+
+        if (quote == '\'')
+        {
+            if (c == '\'')
+                quote = 0;
+            else
+                append(out, &c, 1);
+        }
+        else if (c == '\\' && m_position + 1 < m_size)
+        {
+            // A shell only honours some escapes within double quotes and
+            // joins lines at escaped newlines.
+            Char escaped = data[m_position + 1];
+            if (isShell && quote == '"' && !isShellEscape(escaped))
+                append(out, &c, 1);
+            else if (!isShell || escaped != '\n')
+                append(out, &escaped, 1);
+
+            if (!isShell || quote != '"' || isShellEscape(escaped))
+                m_position++;
+        }
+        else if (quote == '"')
+        {
+            if (c == '"')
+                quote = 0;
+            else
+                append(out, &c, 1);
+        }
+        else if (isAsciiSpace(c))
+        {
+            break;
+        }
+        else if (c == '\'' || c == '"')
+        {
+            quote = c;
+        }
+        else
+        {
+            append(out, &c, 1);
+        }
+
+        m_position++;
+    }
+
+    if (m_position >= m_size && isIncomplete(start))
+    {
+        if (m_arena == nullptr)
+            (m_storage != nullptr ? m_storage : &m_ownStorage)->removeLast();
+
+        return false;
+    }
+    else if (quote != 0)
+    {
+        m_hasError = true;
+    }
+
+    // The arena outlives its scratch buffer, which the next token reuses.
+    const char* bytes = out->constData();
+    if (m_arena != nullptr)
+    {
+        bytes = m_arena->intern(bytes, out->size());
+    }
+
+    *token = makeToken(reinterpret_cast<const Char*>(bytes),
+                       out->size() / static_cast<int>(sizeof(Char)));
+
+    return true;
+}
+
+template<typename Char>
+bool QArgumentTokenizer::nextNulSeparated(const Char* data, QArgumentToken* token)
+{
+    while (m_position < m_size && data[m_position] == '\0')
+    {
+        m_position++;
+    }
+
+    if (m_position >= m_size)
+    {
+        return false;
+    }
+
+    int start = m_position;
+    const Char* end = findNul(data + start, m_size - start);
+
+    if (end == nullptr && isIncomplete(start))
+    {
+        return false;
+    }
+
+    m_position = end != nullptr ? static_cast<int>(end - data) : m_size;
+    *token = makeToken(data + start, m_position - start);
+
+    return true;
+}
+
+bool QArgumentTokenizer::isIncomplete(int start)
+{
+    // The token might continue in the next chunk; resume at its beginning.
+    if (!m_isFinal)
+    {
+        m_position = start;
+        return true;
+    }
+
+    return false;
+}
+
+QByteArray* QArgumentTokenizer::storage()
+{
+    if (m_arena != nullptr)
+    {
+        return m_arena->scratch();
+    }
+
+    QVector<QByteArray>* storage = m_storage != nullptr ? m_storage : &m_ownStorage;
+    storage->append(QByteArray());
+
+    return &storage->last();
+}
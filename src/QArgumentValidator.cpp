@@ -20,45 +20,240 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <QArgumentParser/QArgumentStatistics.hpp>
 #include <QArgumentParser/QArgumentValidator.hpp>
+#include <algorithm>
+#include <climits>
 
-Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_01 = "Invalid option \"%0\".")
-Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_02 = "Invalid argument count for option \"%0\". Expected: %1. Got %2.")
-Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_03 = "Argument at index %0 does not exist. File an issue on Github!")
-Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_04 = "Argument \"%0\" is not of type 'char'.")
-Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_05 = "Argument \"%0\" is not of type 'unsigned char'.")
-Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_06 = "Argument \"%0\" is not of type 'short'.")
-Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_07 = "Argument \"%0\" is not of type 'unsigned short'.")
-Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_08 = "Argument \"%0\" is not of type 'int'.")
-Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_09 = "Argument \"%0\" is not of type 'unsigned int'.")
-Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_10 = "Argument \"%0\" is not of type 'long long'.")
-Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_11 = "Argument \"%0\" is not of type 'unsigned long long'.")
-Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_12 = "File at \"%0\" does not exist.")
-Anonymous(QARGUMENTPARSER_CONSTEXPR auto e_13 = "Directory at \"%0\" does not exist.")
+Anonymous(const QArgumentValidatorOption c_nullOption)
+
+Anonymous(inline void setError(QArgumentError* error, QArgumentError::Code code, const QArgumentToken& s)
+{
+    if (error != nullptr)
+    {
+        error->setCode(code);
+        error->setArgument(s);
+    }
+})
+
+////////////////////////////////////////////////////////////////////////////////
+// Passes errors either to the caller, stopping at the first one, or to a list.
+////////////////////////////////////////////////////////////////////////////////
+struct QArgumentValidator::Report
+{
+    const QArgumentError&    origin;
+    QArgumentError*          first;
+    QVector<QArgumentError>* all;
+
+    // Starts an error of the given code with the option of the origin.
+    QArgumentError make(QArgumentError::Code code, const QString& name) const
+    {
+        QArgumentError error(origin);
+        error.setCode(code);
+        error.setOptionName(name);
+        return error;
+    }
+
+    // Records 'error' and returns whether validation continues.
+    bool add(const QArgumentError& error) const
+    {
+        if (all != nullptr)
+        {
+            all->append(error);
+            return true;
+        }
+
+        *first = error;
+        return false;
+    }
+};
+
+QArgumentValidator::QArgumentValidator()
+    : m_isCompiled(false)
+{
+}
 
 int QArgumentValidator::optionCount() const
 {
-    return m_options.count();
+    return m_options.size();
+}
+
+const QArgumentValidatorOption& QArgumentValidator::optionAt(int index) const
+{
+    if (index < 0 || index >= m_options.size())
+    {
+        return c_nullOption;
+    }
+
+    return m_options.at(index);
+}
+
+const QArgumentValidatorOption& QArgumentValidator::option(const QString& name) const
+{
+    return optionAt(indexOf(name));
 }
 
-QArgumentValidatorOption QArgumentValidator::optionAt(int index) const
+int QArgumentValidator::indexOf(const QString& name) const
 {
-    if (index < 0 || index >= m_options.values().size())
+    if (!m_isCompiled)
     {
-        return QArgumentValidatorOption();
+        return m_optionIndices.value(name, -1);
     }
 
-    return m_options.values().at(index);
+    return indexOf(QArgumentToken::fromUtf16(QStringView(name)));
 }
 
-QArgumentValidatorOption QArgumentValidator::option(const QString& name) const
+int QArgumentValidator::indexOf(const QArgumentToken& name) const
 {
-    return m_options.value(name);
+    if (!m_isCompiled)
+    {
+        return m_optionIndices.value(name.toString(), -1);
+    }
+
+    // Binary search within the sorted name table.
+    int low = 0;
+    int high = m_sortedOptions.size() - 1;
+
+    while (low <= high)
+    {
+        int middle = low + (high - low) / 2;
+        int index = m_sortedOptions.at(middle);
+        int result = name.compare(m_options.at(index).option());
+
+        if (result == 0)
+            return index;
+        else if (result > 0)
+            low = middle + 1;
+        else
+            high = middle - 1;
+    }
+
+    return -1;
+}
+
+int QArgumentValidator::indexOfAbbreviation(const QArgumentToken& name) const
+{
+    auto index = indexOf(name);
+    if (index != -1 || !m_isCompiled || name.isEmpty())
+    {
+        return index;
+    }
+
+    int count = 0;
+    auto first = prefixRange(name, &count);
+
+    return count == 1 ? m_sortedOptions.at(first) : -1;
+}
+
+QVector<int> QArgumentValidator::optionsWithPrefix(const QArgumentToken& prefix) const
+{
+    int count = 0;
+    auto first = prefixRange(prefix, &count);
+
+    return m_sortedOptions.mid(first, count);
+}
+
+const QVector<int>& QArgumentValidator::requiredOptions() const
+{
+    return m_requiredOptions;
+}
+
+bool QArgumentValidator::isCompiled() const
+{
+    return m_isCompiled;
 }
 
 void QArgumentValidator::addOption(const QArgumentValidatorOption& option)
 {
-    m_options.insert(option.option(), option);
+    m_isCompiled = false;
+
+    auto index = m_optionIndices.value(option.option(), -1);
+    if (index != -1)
+    {
+        m_options[index] = option;
+        return;
+    }
+
+    m_optionIndices.insert(option.option(), m_options.size());
+    m_options.append(option);
+}
+
+void QArgumentValidator::compile()
+{
+    if (m_isCompiled)
+    {
+        return;
+    }
+
+    m_sortedOptions.clear();
+    m_types.clear();
+    m_typeOffsets.clear();
+    m_requiredOptions.clear();
+    m_sortedOptions.reserve(m_options.size());
+    m_typeOffsets.reserve(m_options.size() + 1);
+
+    for (int i = 0; i < m_options.size(); i++)
+    {
+        const QArgumentValidatorOption& opt = m_options.at(i);
+
+        m_sortedOptions.append(i);
+        m_typeOffsets.append(m_types.size());
+
+        for (int j = 0; j < opt.argumentCount(); j++)
+        {
+            m_types.append(opt.argumentType(j));
+        }
+
+        if (!opt.isOptional())
+        {
+            m_requiredOptions.append(i);
+        }
+    }
+
+    m_typeOffsets.append(m_types.size());
+
+    std::sort(m_sortedOptions.begin(), m_sortedOptions.end(),
+        [this](int a, int b)
+        {
+            return m_options.at(a).option() < m_options.at(b).option();
+        });
+
+    m_isCompiled = true;
+}
+
+bool QArgumentValidator::validate(
+    const QString& name,
+    const QVector<QArgumentToken>& args,
+    QArgumentError* error,
+    QVector<QArgumentValue>* values) const
+{
+    auto index = indexOf(name);
+
+    // Option validation.
+    if (index == -1 || name.isEmpty())
+    {
+        *error = QArgumentError(QArgumentError::InvalidOption);
+        error->setOptionName(name);
+        return false;
+    }
+
+    return validate(index, args, error, values);
+}
+
+bool QArgumentValidator::validate(
+    const QString& name,
+    const QVector<QArgumentToken>& args,
+    QString* msg,
+    QVector<QArgumentValue>* values) const
+{
+    QArgumentError error;
+    if (!validate(name, args, &error, values))
+    {
+        *msg = error.message();
+        return false;
+    }
+
+    return true;
 }
 
 bool QArgumentValidator::validate(
@@ -66,75 +261,211 @@ bool QArgumentValidator::validate(
     const QVector<QString>& args,
     QString* msg) const
 {
-    QArgumentValidatorOption opt = option(name);
+    // The tokens view 'args', which outlives the validation.
+    QVector<QArgumentToken> tokens;
+    tokens.reserve(args.size());
+    for (const auto& arg : args)
+    {
+        tokens.append(QArgumentToken::fromUtf16(arg));
+    }
+
+    return validate(name, tokens, msg);
+}
+
+bool QArgumentValidator::validate(
+    int index,
+    const QVector<QArgumentToken>& args,
+    QArgumentError* error,
+    QVector<QArgumentValue>* values,
+    QArgumentFileCache* files) const
+{
+    return validate(index, args, QArgumentError(), error, nullptr, values, files);
+}
+
+bool QArgumentValidator::validate(
+    int index,
+    const QVector<QArgumentToken>& args,
+    QVector<QArgumentError>* errors,
+    QVector<QArgumentValue>* values,
+    QArgumentFileCache* files) const
+{
+    return validate(index, args, QArgumentError(), nullptr, errors, values, files);
+}
+
+bool QArgumentValidator::validate(
+    int index,
+    const QVector<QArgumentToken>& args,
+    QString* msg,
+    QVector<QArgumentValue>* values,
+    QArgumentFileCache* files) const
+{
+    QArgumentError error;
+    if (!validate(index, args, &error, values, files))
+    {
+        *msg = error.message();
+        return false;
+    }
+
+    return true;
+}
+
+bool QArgumentValidator::validate(
+    int index,
+    const QVector<QArgumentToken>& args,
+    const QArgumentError& origin,
+    QArgumentError* error,
+    QVector<QArgumentError>* errors,
+    QVector<QArgumentValue>* values,
+    QArgumentFileCache* files) const
+{
+    return validateArguments(index, args, { origin, error, errors }, values, files);
+}
+
+bool QArgumentValidator::validateArguments(
+    int index,
+    const QVector<QArgumentToken>& args,
+    const Report& report,
+    QVector<QArgumentValue>* values,
+    QArgumentFileCache* files) const
+{
+    const QArgumentValidatorOption& opt = optionAt(index);
+    const int listIndex = opt.listIndex();
+    const int listCount = args.size() - opt.argumentCount() + 1;
 
     // Option and argument count validation.
     if (opt.option().isEmpty())
     {
-        *msg = QString(e_01).arg(name);
+        report.add(report.make(QArgumentError::InvalidOption, opt.option()));
         return false;
     }
-    else if (opt.m_arguments.size() != args.size())
+    else if (listIndex == -1 && opt.argumentCount() != args.size())
     {
-        *msg = QString(e_02).arg(name,
-            QString::number(args.size()),
-            QString::number(opt.m_arguments.size()));
+        auto error = report.make(QArgumentError::InvalidArgumentCount, opt.option());
+        error.setArgument(args.value(0), args.isEmpty() ? -1 : 0, args.size());
+        error.setCount(args.size(), opt.argumentCount(), opt.argumentCount());
+        report.add(error);
 
         return false;
     }
+    else if (listIndex != -1 && (listCount < opt.listMinimum() ||
+        (opt.listMaximum() != -1 && listCount > opt.listMaximum())))
+    {
+        auto error = report.make(QArgumentError::InvalidListCount, opt.option());
+        error.setArgument(listCount > 0 ? args.at(listIndex) : QArgumentToken(),
+            listIndex, qMax(listCount, 0));
+        error.setCount(qMax(listCount, 0), opt.listMinimum(), opt.listMaximum());
+        error.setDetail(opt.argumentName(listIndex));
+        report.add(error);
+
+        return false;
+    }
+
+    if (values != nullptr)
+    {
+        values->clear();
+        values->reserve(opt.argumentCount());
+    }
+
+    // The compiled validator keeps the types of all options contiguously.
+    const QArgumentValidatorOption::ArgumentType* types = nullptr;
+    if (m_isCompiled)
+    {
+        types = m_types.constData() + m_typeOffsets.at(index);
+    }
 
-    // Validates every argument itself.
-    for (int i = 0; i < args.size(); i++)
+    // Validates every argument itself; the list takes a range of arguments.
+    auto isValid = true;
+    for (int i = 0, position = 0; i < opt.argumentCount(); i++)
     {
-        auto arg = args.at(i);
+        auto type = types != nullptr ? types[i] : opt.argumentType(i);
+        auto count = i == listIndex ? listCount : 1;
+        const QArgumentToken* range = args.constData() + position;
+        position += count;
+
+        if (QArgumentValidatorOption::isListType(type))
+        {
+            QArgumentValue list;
+            if (!validateList(type, opt.option(), range, count, position - count, &list, report, files))
+            {
+                isValid = false;
+                if (report.all == nullptr)
+                    return false;
+            }
+
+            if (values != nullptr)
+            {
+                values->append(list);
+            }
+
+            continue;
+        }
+
+        const QArgumentToken& arg = *range;
         auto result = true;
+        QArgumentValue value(arg, type);
+        QArgumentError error;
 
         // ! Expand when supporting new types !
-        switch (opt.argumentType(i))
+        switch (type)
         {
             case QArgumentValidatorOption::Invalid:
                 result = false;
-               *msg = QString(e_03).arg(QString::number(i));
+                error.setCode(QArgumentError::InvalidArgumentType);
                 break;
 
             case QArgumentValidatorOption::Char:
-                result = validateChar(arg, msg);
+                result = validateChar(arg, &value, &error);
                 break;
 
             case QArgumentValidatorOption::UInt8:
-                result = validateUChar(arg, msg);
+                result = validateUChar(arg, &value, &error);
                 break;
 
             case QArgumentValidatorOption::Int16:
-                result = validateShort(arg, msg);
+                result = validateShort(arg, &value, &error);
                 break;
 
             case QArgumentValidatorOption::UInt16:
-                result = validateUShort(arg, msg);
+                result = validateUShort(arg, &value, &error);
                 break;
 
             case QArgumentValidatorOption::Int32:
-                result = validateInt(arg, msg);
+                result = validateInt(arg, &value, &error);
                 break;
 
             case QArgumentValidatorOption::UInt32:
-                result = validateUInt(arg, msg);
+                result = validateUInt(arg, &value, &error);
                 break;
 
             case QArgumentValidatorOption::Int64:
-                result = validateInt64(arg, msg);
+                result = validateInt64(arg, &value, &error);
                 break;
 
             case QArgumentValidatorOption::UInt64:
-                result = validateUInt64(arg, msg);
+                result = validateUInt64(arg, &value, &error);
                 break;
 
             case QArgumentValidatorOption::File:
-                result = validateFile(arg, msg);
+            case QArgumentValidatorOption::Directory:
+                if (files != nullptr)
+                {
+                    // The error is prepared now; it is reported if the check fails.
+                    auto check = report.make(QArgumentError::NoError, opt.option());
+                    check.setArgument(arg, position - 1);
+                    files->addCheck(arg.toString(), type, check);
+                }
+                else if (type == QArgumentValidatorOption::File)
+                {
+                    result = validateFile(arg, &value, &error);
+                }
+                else
+                {
+                    result = validateDirectory(arg, &value, &error);
+                }
                 break;
 
-            case QArgumentValidatorOption::Directory:
-                result = validateDirectory(arg, msg);
+            case QArgumentValidatorOption::MappedFile:
+                result = validateMappedFile(arg, &value, &error);
                 break;
 
             default:
@@ -143,122 +474,374 @@ bool QArgumentValidator::validate(
 
         if (result != true)
         {
-            return false;
+            auto failure = report.make(error.code(), opt.option());
+            failure.setArgument(arg, position - 1);
+            isValid = false;
+
+            if (!report.add(failure))
+                return false;
+        }
+
+        if (values != nullptr)
+        {
+            values->append(value);
+        }
+    }
+
+    return isValid;
+}
+
+bool QArgumentValidator::validateList(
+    QArgumentValidatorOption::ArgumentType type,
+    const QString& option,
+    const QArgumentToken* args,
+    int count,
+    int offset,
+    QArgumentValue* value,
+    const Report& report,
+    QArgumentFileCache* files) const
+{
+    QByteArray elements;
+    auto isValid = true;
+
+    // Every invalid element is reported on its own.
+    auto reject = [&](QArgumentError::Code code, int i)
+    {
+        auto error = report.make(code, option);
+        error.setArgument(args[i], offset + i);
+        isValid = false;
+
+        return report.add(error);
+    };
+
+    // Elements are converted straight into the packed storage.
+    if (type == QArgumentValidatorOption::Int32List)
+    {
+        elements.resize(count * static_cast<int>(sizeof(qint32)));
+        auto* numbers = reinterpret_cast<qint32*>(elements.data());
+
+        for (int i = 0; i < count; i++)
+        {
+            auto result = false;
+            numbers[i] = args[i].toInt(&result);
+            if (!result && !reject(QArgumentError::InvalidInt32, i))
+            {
+                return false;
+            }
+        }
+    }
+    else if (type == QArgumentValidatorOption::UInt64List)
+    {
+        elements.resize(count * static_cast<int>(sizeof(quint64)));
+        auto* numbers = reinterpret_cast<quint64*>(elements.data());
+
+        for (int i = 0; i < count; i++)
+        {
+            auto result = false;
+            numbers[i] = args[i].toULongLong(&result);
+            if (!result && !reject(QArgumentError::InvalidUInt64, i))
+            {
+                return false;
+            }
+        }
+    }
+    else
+    {
+        // StringList and FileList keep the tokens themselves.
+        for (int i = 0; i < count && type == QArgumentValidatorOption::FileList; i++)
+        {
+            if (files != nullptr)
+            {
+                auto check = report.make(QArgumentError::NoError, option);
+                check.setArgument(args[i], offset + i);
+                files->addCheck(args[i].toString(), QArgumentValidatorOption::File, check);
+            }
+            else if (!validateFile(args[i], nullptr, nullptr) &&
+                     !reject(QArgumentError::FileNotFound, i))
+            {
+                return false;
+            }
         }
+
+        elements = QByteArray(reinterpret_cast<const char*>(args),
+            count * static_cast<int>(sizeof(QArgumentToken)));
+    }
+
+    *value = QArgumentValue::fromList(type, elements);
+
+    return isValid;
+}
+
+bool QArgumentValidator::validatePaths(QArgumentFileCache* files, QArgumentError* error) const
+{
+    QArgumentError origin;
+    return resolvePaths(files, { origin, error, nullptr });
+}
+
+bool QArgumentValidator::validatePaths(
+    QArgumentFileCache* files,
+    QVector<QArgumentError>* errors) const
+{
+    QArgumentError origin;
+    return resolvePaths(files, { origin, nullptr, errors });
+}
+
+bool QArgumentValidator::validatePaths(QArgumentFileCache* files, QString* msg) const
+{
+    QArgumentError error;
+    if (!validatePaths(files, &error))
+    {
+        *msg = error.message();
+        return false;
     }
 
     return true;
 }
 
-bool QArgumentValidator::validateChar(const QString &s, QString *msg) const
+bool QArgumentValidator::resolvePaths(QArgumentFileCache* files, const Report& report)
+{
+    auto isValid = true;
+    for (auto index = files->resolve(); index != -1; index = files->resolve())
+    {
+        // The error prepared along with the check locates the argument.
+        QArgumentError error(files->checkError(index));
+        error.setCode(files->checkType(index) == QArgumentValidatorOption::Directory
+            ? QArgumentError::DirectoryNotFound
+            : QArgumentError::FileNotFound);
+        error.setDetail(files->checkPath(index));
+        isValid = false;
+
+        if (!report.add(error))
+            break;
+    }
+
+    return isValid;
+}
+
+int QArgumentValidator::prefixRange(const QArgumentToken& prefix, int* count) const
+{
+    // Names starting with 'prefix' follow each other in the sorted table,
+    // beginning at the first name that is not less than 'prefix'.
+    auto begin = m_sortedOptions.constBegin();
+    auto end = m_sortedOptions.constEnd();
+
+    auto first = std::lower_bound(begin, end, prefix,
+        [this](int index, const QArgumentToken& other)
+        {
+            return other.compare(m_options.at(index).option()) > 0;
+        });
+
+    auto last = std::partition_point(first, end,
+        [this, &prefix](int index)
+        {
+            return prefix.isPrefixOf(m_options.at(index).option());
+        });
+
+    *count = static_cast<int>(last - first);
+    return static_cast<int>(first - begin);
+}
+
+bool QArgumentValidator::validateChar(
+    const QArgumentToken& s,
+    QArgumentValue* value,
+    QArgumentError* error)
 {
-    auto unicode = s.at(0).unicode(); // ensured to be not empty!
+    auto unicode = s.isEmpty() ? 0 : s.unitAt(0);
     if (unicode < 32 || unicode > 127)
     {
-        *msg = QString(e_04).arg(s);
+        setError(error, QArgumentError::InvalidChar, s);
         return false;
     }
 
+    *value = QArgumentValue::fromSigned(s, QArgumentValidatorOption::Char,
+        static_cast<qint64>(static_cast<char>(unicode)));
+
     return true;
 }
 
-bool QArgumentValidator::validateUChar(const QString& s, QString* msg) const
+bool QArgumentValidator::validateUChar(
+    const QArgumentToken& s,
+    QArgumentValue* value,
+    QArgumentError* error)
 {
     auto result = false;
     auto byte = s.toInt(&result);
     if (!result || (byte < 0 || byte > 255))
     {
-        *msg = QString(e_05).arg(s);
+        setError(error, QArgumentError::InvalidUInt8, s);
         return false;
     }
 
+    *value = QArgumentValue::fromUnsigned(s, QArgumentValidatorOption::UInt8,
+        static_cast<quint64>(byte));
+
     return true;
 }
 
-bool QArgumentValidator::validateShort(const QString& s, QString* msg) const
+bool QArgumentValidator::validateShort(
+    const QArgumentToken& s,
+    QArgumentValue* value,
+    QArgumentError* error)
 {
-    auto result = false; s.toShort(&result);
+    auto result = false;
+    auto number = s.toShort(&result);
     if (!result)
     {
-        *msg = QString(e_06).arg(s);
+        setError(error, QArgumentError::InvalidInt16, s);
+        return false;
     }
 
-    return result;
+    *value = QArgumentValue::fromSigned(s, QArgumentValidatorOption::Int16, number);
+
+    return true;
 }
 
-bool QArgumentValidator::validateUShort(const QString& s, QString* msg) const
+bool QArgumentValidator::validateUShort(
+    const QArgumentToken& s,
+    QArgumentValue* value,
+    QArgumentError* error)
 {
-    auto result = false; s.toUShort(&result);
+    auto result = false;
+    auto number = s.toUShort(&result);
     if (!result)
     {
-        *msg = QString(e_07).arg(s);
+        setError(error, QArgumentError::InvalidUInt16, s);
+        return false;
     }
 
-    return result;
+    *value = QArgumentValue::fromUnsigned(s, QArgumentValidatorOption::UInt16, number);
+
+    return true;
 }
 
-bool QArgumentValidator::validateInt(const QString& s, QString* msg) const
+bool QArgumentValidator::validateInt(
+    const QArgumentToken& s,
+    QArgumentValue* value,
+    QArgumentError* error)
 {
-    auto result = false; s.toInt(&result);
+    auto result = false;
+    auto number = s.toInt(&result);
     if (!result)
     {
-        *msg = QString(e_08).arg(s);
+        setError(error, QArgumentError::InvalidInt32, s);
+        return false;
     }
 
-    return result;
+    *value = QArgumentValue::fromSigned(s, QArgumentValidatorOption::Int32, number);
+
+    return true;
 }
 
-bool QArgumentValidator::validateUInt(const QString& s, QString* msg) const
+bool QArgumentValidator::validateUInt(
+    const QArgumentToken& s,
+    QArgumentValue* value,
+    QArgumentError* error)
 {
-    auto result = false; s.toUInt(&result);
+    auto result = false;
+    auto number = s.toUInt(&result);
     if (!result)
     {
-        *msg = QString(e_09).arg(s);
+        setError(error, QArgumentError::InvalidUInt32, s);
+        return false;
     }
 
-    return result;
+    *value = QArgumentValue::fromUnsigned(s, QArgumentValidatorOption::UInt32, number);
+
+    return true;
 }
 
-bool QArgumentValidator::validateInt64(const QString& s, QString* msg) const
+bool QArgumentValidator::validateInt64(
+    const QArgumentToken& s,
+    QArgumentValue* value,
+    QArgumentError* error)
 {
-    auto result = false; s.toLongLong(&result);
+    auto result = false;
+    auto number = s.toLongLong(&result);
     if (!result)
     {
-        *msg = QString(e_10).arg(s);
+        setError(error, QArgumentError::InvalidInt64, s);
+        return false;
     }
 
-    return result;
+    *value = QArgumentValue::fromSigned(s, QArgumentValidatorOption::Int64, number);
+
+    return true;
 }
 
-bool QArgumentValidator::validateUInt64(const QString& s, QString* msg) const
+bool QArgumentValidator::validateUInt64(
+    const QArgumentToken& s,
+    QArgumentValue* value,
+    QArgumentError* error)
 {
-    auto result = false; s.toULongLong(&result);
+    auto result = false;
+    auto number = s.toULongLong(&result);
     if (!result)
     {
-        *msg = QString(e_11).arg(s);
+        setError(error, QArgumentError::InvalidUInt64, s);
+        return false;
     }
 
-    return result;
+    *value = QArgumentValue::fromUnsigned(s, QArgumentValidatorOption::UInt64, number);
+
+    return true;
 }
 
-bool QArgumentValidator::validateFile(const QString& s, QString* msg) const
+bool QArgumentValidator::validateFile(
+    const QArgumentToken& s,
+    QArgumentValue*,
+    QArgumentError* error)
 {
-    if (!QFileInfo(s).exists())
+    QARGUMENTPARSER_STATISTICS(QArgumentStatistics::record(QArgumentStatistics::FileProbes));
+
+    if (!QFileInfo(s.toString()).exists())
     {
-        *msg = QString(e_12).arg(s);
+        setError(error, QArgumentError::FileNotFound, s);
         return false;
     }
 
     return true;
 }
 
-bool QArgumentValidator::validateDirectory(const QString& s, QString* msg) const
+bool QArgumentValidator::validateDirectory(
+    const QArgumentToken& s,
+    QArgumentValue*,
+    QArgumentError* error)
 {
-    if (!QDir(s).exists())
+    QARGUMENTPARSER_STATISTICS(QArgumentStatistics::record(QArgumentStatistics::FileProbes));
+
+    if (!QDir(s.toString()).exists())
     {
-        *msg = QString(e_13).arg(s);
+        setError(error, QArgumentError::DirectoryNotFound, s);
         return false;
     }
 
     return true;
 }
+
+bool QArgumentValidator::validateMappedFile(
+    const QArgumentToken& s,
+    QArgumentValue* value,
+    QArgumentError* error)
+{
+    QARGUMENTPARSER_STATISTICS(QArgumentStatistics::record(QArgumentStatistics::FileProbes));
+
+    QSharedPointer<const QArgumentMappedFile> file(new QArgumentMappedFile(s.toString()));
+    if (!file->isMapped())
+    {
+        setError(error, QArgumentError::FileNotMappable, s);
+        return false;
+    }
+
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    // Qt 5 byte arrays, which view the contents, are limited to INT_MAX bytes.
+    if (file->size() > INT_MAX)
+    {
+        setError(error, QArgumentError::FileTooLarge, s);
+        return false;
+    }
+#endif
+
+    *value = QArgumentValue::fromMappedFile(s, file);
+
+    return true;
+}
@@ -23,8 +23,11 @@
 #include <QArgumentParser/QArgumentValidator.hpp>
 #include <QArgumentParser/QArgumentValidatorOption.hpp>
 
+Anonymous(const QString c_nullName)
+
 QArgumentValidatorOption::QArgumentValidatorOption(const QString& option)
     : m_option(option)
+    , m_listIndex(-1)
     , m_isOptional(false)
 {
 }
@@ -34,31 +37,61 @@ const QString& QArgumentValidatorOption::option() const
     return m_option;
 }
 
-const QString QArgumentValidatorOption::argumentName(int index) const
+int QArgumentValidatorOption::argumentCount() const
+{
+    return m_arguments.size();
+}
+
+int QArgumentValidatorOption::argumentIndex(const QString& name) const
+{
+    return m_argumentIndices.value(name, -1);
+}
+
+const QString& QArgumentValidatorOption::argumentName(int index) const
 {
-    if (index < 0 || index >= m_arguments.keys().size())
+    if (index < 0 || index >= m_arguments.size())
     {
-        return QString();
+        return c_nullName;
     }
 
-    return m_arguments.keys().at(index);
+    return m_arguments.at(index).name;
 }
 
 QArgumentValidatorOption::ArgumentType QArgumentValidatorOption::argumentType(
     const QString &arg) const
 {
-    return m_arguments.value(arg, QArgumentValidatorOption::Invalid);
+    return argumentType(argumentIndex(arg));
 }
 
 QArgumentValidatorOption::ArgumentType QArgumentValidatorOption::argumentType(
     int index) const
 {
-    if (index < 0 || index >= m_arguments.values().size())
+    if (index < 0 || index >= m_arguments.size())
     {
         return QArgumentValidatorOption::Invalid;
     }
 
-    return m_arguments.values().at(index);
+    return m_arguments.at(index).type;
+}
+
+int QArgumentValidatorOption::listIndex() const
+{
+    return m_listIndex;
+}
+
+int QArgumentValidatorOption::listMinimum() const
+{
+    return m_listIndex != -1 ? m_arguments.at(m_listIndex).minimum : 0;
+}
+
+int QArgumentValidatorOption::listMaximum() const
+{
+    return m_listIndex != -1 ? m_arguments.at(m_listIndex).maximum : -1;
+}
+
+bool QArgumentValidatorOption::isListType(ArgumentType type)
+{
+    return type >= Int32List && type <= FileList;
 }
 
 bool QArgumentValidatorOption::isOptional() const
@@ -66,11 +99,42 @@ bool QArgumentValidatorOption::isOptional() const
     return m_isOptional;
 }
 
+QString QArgumentValidatorOption::environmentVariable() const
+{
+    return QString::fromLocal8Bit(m_environmentVariable);
+}
+
+const QString& QArgumentValidatorOption::configKey() const
+{
+    return m_configKey;
+}
+
+const QStringList& QArgumentValidatorOption::defaultArguments() const
+{
+    return m_defaultArguments;
+}
+
 void QArgumentValidatorOption::setOptional(bool optional)
 {
     m_isOptional = optional;
 }
 
+void QArgumentValidatorOption::setEnvironmentVariable(const QString& name)
+{
+    // Kept in the encoding of the environment to look it up without converting.
+    m_environmentVariable = name.toLocal8Bit();
+}
+
+void QArgumentValidatorOption::setConfigKey(const QString& key)
+{
+    m_configKey = key;
+}
+
+void QArgumentValidatorOption::setDefaultArguments(const QStringList& arguments)
+{
+    m_defaultArguments = arguments;
+}
+
 void QArgumentValidatorOption::setOption(const QString& option)
 {
     m_option = option;
@@ -78,5 +142,37 @@ void QArgumentValidatorOption::setOption(const QString& option)
 
 void QArgumentValidatorOption::addArgument(const QString& name, ArgumentType type)
 {
-    m_arguments.insert(name, type);
+    addArgument(name, type, 0, -1);
+}
+
+void QArgumentValidatorOption::addArgument(
+    const QString& name,
+    ArgumentType type,
+    int minimum,
+    int maximum)
+{
+    minimum = qMax(minimum, 0);
+    maximum = maximum < 0 ? -1 : qMax(maximum, minimum);
+
+    auto index = argumentIndex(name);
+    if (index != -1)
+    {
+        m_arguments[index].type = type;
+        m_arguments[index].minimum = minimum;
+        m_arguments[index].maximum = maximum;
+    }
+    else
+    {
+        Argument argument = { name, type, minimum, maximum };
+        m_argumentIndices.insert(name, m_arguments.size());
+        m_arguments.append(argument);
+    }
+
+    // The first list declared takes the variable amount of arguments.
+    m_listIndex = -1;
+    for (int i = 0; i < m_arguments.size() && m_listIndex == -1; i++)
+    {
+        if (isListType(m_arguments.at(i).type))
+            m_listIndex = i;
+    }
 }
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <QArgumentParser/QArgumentValue.hpp>
+
+QArgumentValue::QArgumentValue()
+    : m_type(QArgumentValidatorOption::Invalid)
+    , m_isSigned(false)
+    , m_unsigned(0)
+{
+}
+
+QArgumentValue::QArgumentValue(const QArgumentToken& token)
+    : m_token(token)
+    , m_type(QArgumentValidatorOption::Invalid)
+    , m_isSigned(false)
+    , m_unsigned(0)
+{
+}
+
+QArgumentValue::QArgumentValue(
+    const QArgumentToken& token,
+    QArgumentValidatorOption::ArgumentType type)
+    : m_token(token)
+    , m_type(type)
+    , m_isSigned(false)
+    , m_unsigned(0)
+{
+}
+
+QArgumentValue QArgumentValue::fromSigned(
+    const QArgumentToken& token,
+    QArgumentValidatorOption::ArgumentType type,
+    qint64 value)
+{
+    QArgumentValue result(token, type);
+    result.m_isSigned = true;
+    result.m_signed = value;
+
+    return result;
+}
+
+QArgumentValue QArgumentValue::fromUnsigned(
+    const QArgumentToken& token,
+    QArgumentValidatorOption::ArgumentType type,
+    quint64 value)
+{
+    QArgumentValue result(token, type);
+    result.m_isSigned = false;
+    result.m_unsigned = value;
+
+    return result;
+}
+
+QArgumentValue QArgumentValue::fromMappedFile(
+    const QArgumentToken& token,
+    const QSharedPointer<const QArgumentMappedFile>& file)
+{
+    QArgumentValue result(token, QArgumentValidatorOption::MappedFile);
+    result.m_mappedFile = file;
+
+    return result;
+}
+
+QArgumentValue QArgumentValue::fromList(
+    QArgumentValidatorOption::ArgumentType type,
+    const QByteArray& elements)
+{
+    QArgumentValue result(QArgumentToken(), type);
+    result.m_list = elements;
+
+    return result;
+}
@@ -0,0 +1,299 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// QArgumentParser - Command line argument parser using the QtCore module.
+// Copyright (C) 2017 Nicolas Kogler
+//
+// This file is part of QArgumentParser.
+//
+// QArgumentParser is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// QArgumentParser is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with QArgumentParser. If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <QArgumentParser/QArgumentParser.hpp>
+#include <QArgumentParser/QArgumentToken.hpp>
+#include <QString>
+#include <atomic>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+
+////////////////////////////////////////////////////////////////////////////////
+// Counts every heap allocation made by the process.
+////////////////////////////////////////////////////////////////////////////////
+static std::atomic<quint64> g_allocations(0);
+
+void* operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+
+    void* memory = std::malloc(size != 0 ? size : 1);
+    if (memory == nullptr)
+    {
+        std::abort();
+    }
+
+    return memory;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Compares one conversion of 'input', as UTF-8 and UTF-16 token, with the
+// QString conversion the validator used before tokens. Prints every mismatch.
+////////////////////////////////////////////////////////////////////////////////
+template<typename T>
+static bool checkConversion(
+    const char* name,
+    const QByteArray& input,
+    T (QArgumentToken::*convert)(bool*) const,
+    T (QString::*reference)(bool*, int) const)
+{
+    QString text = QString::fromUtf8(input);
+    auto utf8 = QArgumentToken::fromUtf8(input.constData(), input.size());
+    auto utf16 = QArgumentToken::fromUtf16(QStringView(text));
+
+    bool expectedOk = false;
+    T expected = (text.*reference)(&expectedOk, 10);
+
+    bool isValid = true;
+    for (int i = 0; i < 2; i++)
+    {
+        bool ok = false;
+        T value = i == 0 ? (utf8.*convert)(&ok) : (utf16.*convert)(&ok);
+
+        if (value != expected || ok != expectedOk)
+        {
+            std::fprintf(stderr, "FAIL convert/%s (%s): input %s, ok %d, expected ok %d\n",
+                name,
+                i == 0 ? "utf8" : "utf16",
+                input.toHex().constData(),
+                ok ? 1 : 0,
+                expectedOk ? 1 : 0);
+
+            isValid = false;
+        }
+    }
+
+    return isValid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Compares QArgumentToken::trimmed with QString::trimmed.
+////////////////////////////////////////////////////////////////////////////////
+static bool checkTrimmed(const QByteArray& input)
+{
+    QString text = QString::fromUtf8(input);
+    QString expected = text.trimmed();
+
+    auto utf8 = QArgumentToken::fromUtf8(input.constData(), input.size()).trimmed();
+    auto utf16 = QArgumentToken::fromUtf16(QStringView(text)).trimmed();
+    if (utf8.toString() != expected || utf16.toString() != expected)
+    {
+        std::fprintf(stderr, "FAIL trimmed: input %s\n", input.toHex().constData());
+        return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Random input covering both the fast path and the fallback: digits, signs,
+// ASCII and Unicode whitespace, stray UTF-8 bytes and values around every
+// type's limits.
+////////////////////////////////////////////////////////////////////////////////
+static QByteArray randomInput(std::mt19937* random, int index)
+{
+    static const QByteArray c_limits[] =
+    {
+        QByteArray::number(static_cast<qint64>(SHRT_MIN)),
+        QByteArray::number(static_cast<qint64>(SHRT_MAX)),
+        QByteArray::number(static_cast<qint64>(USHRT_MAX)),
+        QByteArray::number(static_cast<qint64>(INT_MIN)),
+        QByteArray::number(static_cast<qint64>(INT_MAX)),
+        QByteArray::number(static_cast<qint64>(UINT_MAX)),
+        QByteArray::number(static_cast<qint64>(LLONG_MIN)),
+        QByteArray::number(static_cast<qint64>(LLONG_MAX)),
+        QByteArray::number(static_cast<quint64>(ULLONG_MAX))
+    };
+
+    // Digits dominate, so that many inputs take the fast path.
+    static const char* c_pieces[] =
+    {
+        "0", "1", "2", "3", "4", "5", "6", "7", "8", "9",
+        "0", "1", "2", "3", "4", "5", "6", "7", "8", "9",
+        "-", "+", " ", "\t", "\n", "x",
+        "\xC2\xA0", "\xC2\x85", "\xE2\x80\x80", "\xE3\x80\x80", "\xE2\x80\x8B",
+        "\xEF\xBC\x91", "\x80", "\xC2", "\xC0\xA0"
+    };
+
+    const int limitCount = static_cast<int>(sizeof(c_limits) / sizeof(c_limits[0]));
+    const int pieceCount = static_cast<int>(sizeof(c_pieces) / sizeof(c_pieces[0]));
+
+    QByteArray input;
+    if (index % 2 == 0)
+    {
+        // A limit with its last digits replaced, possibly one digit longer.
+        input = c_limits[(*random)() % limitCount];
+        input[input.size() - 1] = static_cast<char>('0' + (*random)() % 10);
+        if ((*random)() % 2 == 0)
+            input[input.size() - 2] = static_cast<char>('0' + (*random)() % 10);
+        if ((*random)() % 8 == 0)
+            input.append(static_cast<char>('0' + (*random)() % 10));
+        if ((*random)() % 8 == 0)
+            input = QByteArray(c_pieces[(*random)() % pieceCount]).append(input);
+        if ((*random)() % 8 == 0)
+            input.append(c_pieces[(*random)() % pieceCount]);
+    }
+    else
+    {
+        auto length = static_cast<int>((*random)() % 23);
+        for (int i = 0; i < length; i++)
+        {
+            input.append(c_pieces[(*random)() % pieceCount]);
+        }
+    }
+
+    return input;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// The numeric conversions and trimming of QArgumentToken must match QString.
+////////////////////////////////////////////////////////////////////////////////
+static bool testConversions()
+{
+    const int iterations = 1000000;
+    std::mt19937 random(20171013);
+    auto mismatches = 0;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        QByteArray input = randomInput(&random, i);
+
+        auto isValid =
+            checkTrimmed(input) &
+            checkConversion<short>("short", input, &QArgumentToken::toShort, &QString::toShort) &
+            checkConversion<ushort>("ushort", input, &QArgumentToken::toUShort, &QString::toUShort) &
+            checkConversion<int>("int", input, &QArgumentToken::toInt, &QString::toInt) &
+            checkConversion<uint>("uint", input, &QArgumentToken::toUInt, &QString::toUInt) &
+            checkConversion<qint64>("qint64", input, &QArgumentToken::toLongLong, &QString::toLongLong) &
+            checkConversion<quint64>("quint64", input, &QArgumentToken::toULongLong, &QString::toULongLong);
+
+        mismatches += isValid ? 0 : 1;
+    }
+
+    std::printf("%s convert: %d inputs, %d mismatches\n",
+        mismatches == 0 ? "PASS" : "FAIL",
+        iterations,
+        mismatches);
+
+    return mismatches == 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// A reused parser sharing its validator must not allocate once it has grown.
+////////////////////////////////////////////////////////////////////////////////
+static bool testReparseAllocations()
+{
+    QSharedPointer<QArgumentValidator> validator(new QArgumentValidator);
+    QArgumentValidatorOption user("user"), limit("limit"), verbose("verbose");
+
+    user.addArgument("name", QArgumentValidatorOption::String);
+    limit.addArgument("count", QArgumentValidatorOption::Int32);
+    limit.addArgument("bytes", QArgumentValidatorOption::UInt64);
+    verbose.setOptional(true);
+    validator->addOption(user);
+    validator->addOption(limit);
+    validator->addOption(verbose);
+    validator->compile();
+
+    const char* commands[][6] =
+    {
+        { "-user", "admin", "-limit", "10", "1048576", "-verbose" },
+        { "-limit", "20", "2097152", "-user", "operator", "-verbose" }
+    };
+
+    // Quoted and escaped arguments are interned into the arena.
+    QString lines[] =
+    {
+        QStringLiteral("-user 'the admin' -limit 10 1048576 -verbose"),
+        QStringLiteral("-limit 20 2097152 -user \"the\\ operator\" -verbose")
+    };
+
+    QArgumentParser parser(0, nullptr);
+    parser.setValidator(QSharedPointer<const QArgumentValidator>(validator));
+    parser.setArenaEnabled(true);
+
+    // Lets the buffers grow to their final size.
+    for (int i = 0; i < 4; i++)
+    {
+        parser.parse(commands[i % 2], 6);
+        parser.parse(lines[i % 2]);
+    }
+
+    const int iterations = 100000;
+    auto allocations = g_allocations.load();
+    auto failures = 0;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        parser.reset();
+        failures += parser.parse(commands[i % 2], 6) != QArgumentParser::Success;
+        failures += parser.parse(lines[i % 2]) != QArgumentParser::Success;
+    }
+
+    allocations = g_allocations.load() - allocations;
+
+    auto isValid = failures == 0 && allocations == 0;
+    std::printf("%s reparse: %d iterations, %d failures, %llu allocations\n",
+        isValid ? "PASS" : "FAIL",
+        iterations,
+        failures,
+        static_cast<unsigned long long>(allocations));
+
+    return isValid;
+}
+
+int main()
+{
+    auto isValid = testConversions();
+    isValid = testReparseAllocations() && isValid;
+
+    std::fflush(stdout);
+    return isValid ? 0 : 1;
+}